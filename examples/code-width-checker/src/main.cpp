@@ -68,8 +68,7 @@ main(int argc,
 
     argparse::Namespace const args = parser.parse_args();
     std::size_t limit = args.get<std::size_t>("limit");
-    std::vector<std::string> files
-            = args.get<std::vector<std::string> >("file");
+    std::vector<std::string> const& files = args.values_view("file");
     bool show_lines = args.get<bool>("show_lines");
 
     for (std::size_t i = 0; i < files.size(); ++i) {
@@ -0,0 +1,176 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * MIT License
+ *
+ * Help formatting benchmark for long and unicode texts (help-benchmark)
+ *
+ * Copyright (c) 2026 Golubchikov Mihail <https://github.com/rue-ryuzaki>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <argparse/argparse_decl.hpp>
+
+char const version[] = "%(prog)s v0.1.0";
+
+double
+elapsed_ms(
+        std::clock_t start)
+{
+    return 1000.0 * static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC;
+}
+
+void
+append_utf8(
+        std::string& str,
+        uint32_t cp)
+{
+    if (cp < 0x80) {
+        str += static_cast<char>(cp);
+    } else if (cp < 0x800) {
+        str += static_cast<char>(0xC0 | (cp >> 6));
+        str += static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        str += static_cast<char>(0xE0 | (cp >> 12));
+        str += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        str += static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+        str += static_cast<char>(0xF0 | (cp >> 18));
+        str += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        str += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        str += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+}
+
+// words of the letters from the unicode to upper table (Latin to Adlam)
+std::string
+unicode_word(
+        std::size_t i)
+{
+    static uint32_t const ranges[][2] = {
+        { 0x0061, 0x007a }, { 0x00e0, 0x00fe }, { 0x03b1, 0x03c9 },
+        { 0x0430, 0x044f }, { 0x0561, 0x0586 }, { 0x10d0, 0x10fa },
+        { 0x1e01, 0x1e95 }, { 0x2170, 0x217f }, { 0x24d0, 0x24e9 },
+        { 0xff41, 0xff5a }, { 0x10428, 0x1044f }, { 0x1e922, 0x1e943 }
+    };
+    std::size_t const count = sizeof(ranges) / sizeof(ranges[0]);
+    uint32_t const* range = ranges[i % count];
+    std::string res;
+    for (std::size_t j = 0; j < 3 + i % 7; ++j) {
+        append_utf8(res, range[0] + static_cast<uint32_t>(
+                        (i + j) % (range[1] - range[0] + 1)));
+    }
+    return res;
+}
+
+std::string
+text(
+        std::size_t size,
+        bool unicode)
+{
+    std::string res;
+    res.reserve(size + 32);
+    for (std::size_t i = 0; res.size() < size; ++i) {
+        if (unicode && i % 4 == 0) {
+            res += unicode_word(i);
+        } else {
+            res += "text";
+        }
+        res += (i % 16 == 15) ? "\n" : " ";
+    }
+    return res;
+}
+
+void
+run(std::string const& name,
+        argparse::ArgumentParser const& parser,
+        std::size_t repeat)
+{
+    std::size_t size = 0;
+    std::clock_t const start = std::clock();
+    for (std::size_t i = 0; i < repeat; ++i) {
+        size += parser.format_help().size();
+    }
+    std::cout << name << elapsed_ms(start) / static_cast<double>(repeat)
+              << " ms/run (" << size / repeat << " bytes)" << std::endl;
+}
+
+int
+main(int argc,
+        char const* const argv[])
+{
+    argparse::ArgumentParser program = argparse::ArgumentParser(argc, argv)
+            .description("Help formatting benchmark for long and unicode texts")
+            .epilog("by rue-ryuzaki (c) 2026");
+    program.add_argument("--version")
+            .action("version")
+            .version(version);
+    program.add_argument("-n", "--arguments")
+            .type<std::size_t>()
+            .default_value("400")
+            .help("number of parser arguments (default: %(default)s)");
+    program.add_argument("-s", "--size")
+            .type<std::size_t>()
+            .default_value("10")
+            .help("size of the description text in megabytes "
+                  "(default: %(default)s)");
+    program.add_argument("-r", "--repeat")
+            .type<std::size_t>()
+            .default_value("10")
+            .help("number of format runs (default: %(default)s)");
+
+    argparse::Namespace const opts = program.parse_args();
+    std::size_t const size = opts.get<std::size_t>("arguments");
+    std::size_t const text_size = opts.get<std::size_t>("size") << 20;
+    std::size_t const repeat = opts.get<std::size_t>("repeat");
+    if (repeat == 0) {
+        program.error("repeat must be positive");
+    }
+
+    argparse::ArgumentParser ascii
+            = argparse::ArgumentParser().prog("benchmark").output_width(80);
+    argparse::ArgumentParser unicode
+            = argparse::ArgumentParser().prog("benchmark").output_width(80);
+    for (std::size_t i = 0; i < size; ++i) {
+        std::stringstream ss;
+        ss << i;
+        ascii.add_argument("--option-" + ss.str())
+                .help("help of the option " + ss.str());
+        unicode.add_argument("--" + unicode_word(i) + "-" + ss.str())
+                .help(unicode_word(i + 1) + " " + unicode_word(i + 2));
+    }
+    run("ascii arguments:      ", ascii, repeat);
+    run("unicode arguments:    ", unicode, repeat);
+
+    argparse::ArgumentParser ascii_text = argparse::ArgumentParser()
+            .prog("benchmark").output_width(80)
+            .description(text(text_size, false));
+    argparse::ArgumentParser unicode_text = argparse::ArgumentParser()
+            .prog("benchmark").output_width(80)
+            .description(text(text_size, true));
+    run("ascii description:    ", ascii_text, 1);
+    run("unicode description:  ", unicode_text, 1);
+    return 0;
+}
@@ -0,0 +1,127 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * MIT License
+ *
+ * Parse time benchmark for parsers with many arguments (parse-benchmark)
+ *
+ * Copyright (c) 2026 Golubchikov Mihail <https://github.com/rue-ryuzaki>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <argparse/argparse_decl.hpp>
+
+char const version[] = "%(prog)s v0.1.0";
+
+std::string
+option_name(
+        std::size_t i)
+{
+    std::stringstream ss;
+    ss << "--option-" << i;
+    return ss.str();
+}
+
+double
+elapsed_ms(
+        std::clock_t start)
+{
+    return 1000.0 * static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC;
+}
+
+int
+main(int argc,
+        char const* const argv[])
+{
+    argparse::ArgumentParser program = argparse::ArgumentParser(argc, argv)
+            .description("Parse time benchmark for parsers with many arguments")
+            .epilog("by rue-ryuzaki (c) 2026");
+    program.add_argument("--version")
+            .action("version")
+            .version(version);
+    program.add_argument("-n", "--arguments")
+            .type<std::size_t>()
+            .default_value("5000")
+            .help("number of parser arguments (default: %(default)s)");
+    program.add_argument("-s", "--step")
+            .type<std::size_t>()
+            .default_value("10")
+            .help("pass every N-th argument on the command line "
+                  "(default: %(default)s)");
+    program.add_argument("-r", "--repeat")
+            .type<std::size_t>()
+            .default_value("10")
+            .help("number of parse runs (default: %(default)s)");
+    program.add_argument("-f", "--freeze")
+            .action("store_true")
+            .help("freeze the parser before parsing");
+
+    argparse::Namespace const opts = program.parse_args();
+    std::size_t const size = opts.get<std::size_t>("arguments");
+    std::size_t const step = opts.get<std::size_t>("step");
+    std::size_t const repeat = opts.get<std::size_t>("repeat");
+    if (step == 0 || repeat == 0) {
+        program.error("step and repeat must be positive");
+    }
+
+    std::clock_t start = std::clock();
+    argparse::ArgumentParser parser
+            = argparse::ArgumentParser().prog("benchmark").add_help(false);
+    std::vector<std::string> args;
+    for (std::size_t i = 0; i < size; ++i) {
+        parser.add_argument(option_name(i)).help("option");
+        if (i % step == 0) {
+            args.push_back(option_name(i));
+            args.push_back("value");
+        }
+    }
+    if (opts.get<bool>("freeze")) {
+        parser.freeze();
+    }
+    std::cout << "build parser:   " << elapsed_ms(start) << " ms" << std::endl;
+
+    start = std::clock();
+    for (std::size_t i = 0; i < repeat; ++i) {
+        parser.parse_args(args);
+    }
+    std::cout << "parse_args:     " << elapsed_ms(start) / static_cast<double>(repeat)
+              << " ms/run" << std::endl;
+
+    argparse::Namespace const res = parser.parse_args(args);
+    std::size_t found = 0;
+    start = std::clock();
+    for (std::size_t i = 0; i < repeat; ++i) {
+        for (std::size_t j = 0; j < size; ++j) {
+            if (!res.get<std::string>(option_name(j)).empty()) {
+                ++found;
+            }
+        }
+    }
+    std::cout << "Namespace get:  " << elapsed_ms(start) / static_cast<double>(repeat)
+              << " ms/run (" << size << " lookups, " << found / repeat
+              << " found)" << std::endl;
+    return 0;
+}
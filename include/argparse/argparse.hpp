@@ -49,6 +49,7 @@
 #undef ARGPARSE_CXX_23
 #undef ARGPARSE_CXX_26
 // -- features ----------------------------------------------------------------
+#undef ARGPARSE_HAS_FROM_CHARS
 #undef ARGPARSE_HAS_OPTIONAL
 #undef ARGPARSE_HAS_SPAN
 #undef ARGPARSE_HAS_STRING_VIEW
@@ -154,6 +155,8 @@
 #  endif  // ARGPARSE_ENABLE_TERMINAL_SIZE_DETECTION
 #  include <unistd.h>
 # endif  // _WIN32
+# include <sys/types.h>
+# include <sys/stat.h>
 # include <time.h>
 #endif  // ARGPARSE_INL
 
@@ -203,18 +206,25 @@
 // -- #include ----------------------------------------------------------------
 #ifdef ARGPARSE_CXX_11
 # include <array>
+# include <atomic>
 # include <cstdint>
 # include <functional>
 # include <initializer_list>
 # include <memory>
+# include <mutex>
+# include <system_error>
+# include <thread>
 # include <tuple>
 # include <type_traits>
 # include <unordered_map>
+# include <unordered_set>
 #else
 # include <stdint.h>
+# include <map>
 # include <set>
 #endif  // C++11+
 
+#include <algorithm>
 #include <cctype>
 #include <cstddef>
 #include <cstdlib>
@@ -238,6 +248,10 @@
 # include <optional>
 #endif  // ARGPARSE_HAS_OPTIONAL
 
+#ifdef ARGPARSE_HAS_STRING_VIEW
+# include <string_view>
+#endif  // ARGPARSE_HAS_STRING_VIEW
+
 #ifdef __has_include
 # if __has_include(<version>)
 #  include <version>
@@ -249,14 +263,14 @@
 # define ARGPARSE_HAS_SPAN
 #endif  // __cpp_lib_span
 
+#if defined(ARGPARSE_CXX_17) && defined(__cpp_lib_to_chars)
+# include <charconv>
+# define ARGPARSE_HAS_FROM_CHARS
+#endif  // C++17+ && __cpp_lib_to_chars
+
 #ifdef ARGPARSE_INL
+# include <cstring>
 # include <fstream>
-# ifdef ARGPARSE_CXX_11
-#  include <regex>
-# endif  // C++11+
-# ifdef ARGPARSE_HAS_STRING_VIEW
-#  include <string_view>
-# endif  // ARGPARSE_HAS_STRING_VIEW
 #endif  // ARGPARSE_INL
 
 // -- version -----------------------------------------------------------------
@@ -1133,6 +1147,10 @@ template <class T>
 struct func1 { typedef std::function<void(T)> type; };
 template <class T, class U>
 struct func2 { typedef std::function<void(T, U)> type; };
+template <class K, class V>
+struct hash_map { typedef std::unordered_map<K, V> type; };
+template <class K>
+struct hash_set { typedef std::unordered_set<K> type; };
 
 using std::shared_ptr;
 using std::weak_ptr;
@@ -1144,6 +1162,10 @@ template <class T>
 struct func1 { typedef void (*type)(T); };
 template <class T, class U>
 struct func2 { typedef void (*type)(T, U); };
+template <class K, class V>
+struct hash_map { typedef std::map<K, V> type; };
+template <class K>
+struct hash_set { typedef std::set<K> type; };
 
 struct ref_count_data
 {
@@ -2125,11 +2147,104 @@ private:
     bool    m_suppress;
 };
 
+template <class T>
+class CowValue
+{
+public:
+    typedef T value_type;
+
+    CowValue()
+        : m_value()
+    { }
+
+    CowValue(CowValue const& orig)
+        : m_value(orig.m_value)
+    { }
+
+    explicit
+    CowValue(T const& orig)
+        : m_value(make_shared<T>(orig))
+    { }
+
+    inline CowValue&
+    operator =(
+            CowValue const& rhs)
+    {
+        if (this != &rhs) {
+            m_value = rhs.m_value;
+        }
+        return *this;
+    }
+
+#ifdef ARGPARSE_CXX_11
+    CowValue(CowValue&& orig) ARGPARSE_NOEXCEPT
+        : m_value(std::move(orig.m_value))
+    { }
+
+    explicit
+    CowValue(T&& orig)
+        : m_value(std::make_shared<T>(std::move(orig)))
+    { }
+
+    inline CowValue&
+    operator =(
+            CowValue&& rhs) ARGPARSE_NOEXCEPT
+    {
+        if (this != &rhs) {
+            m_value = std::move(rhs.m_value);
+        }
+        return *this;
+    }
+#endif  // C++11+
+
+    inline T const&
+    value() const ARGPARSE_NOEXCEPT
+    {
+        return m_value ? *m_value : empty();
+    }
+
+    // copies the shared value before the first change
+    inline T&
+    data()
+    {
+        if (!m_value) {
+            m_value = shared_ptr<T>(new T());
+        } else if (m_value.use_count() > 1) {
+            m_value = make_shared<T>(*m_value);
+        }
+        return *m_value;
+    }
+
+    inline void
+    swap(CowValue& other) ARGPARSE_NOEXCEPT
+    {
+        m_value.swap(other.m_value);
+    }
+
+private:
+    static T const&
+    empty() ARGPARSE_NOEXCEPT
+    {
+        static T const res;
+        return res;
+    }
+
+    // -- data ----------------------------------------------------------------
+    shared_ptr<T> m_value;
+};
+
 bool
 _is_type_correct(
         std::string const& expected,
         std::string const& received) ARGPARSE_NOEXCEPT;
 
+// argument names and flags changes, the storages check it before the lookup
+std::size_t
+_names_version() ARGPARSE_NOEXCEPT;
+
+void
+_names_changed() ARGPARSE_NOEXCEPT;
+
 void
 _check_type(
         Value<std::string> const& expected,
@@ -2148,6 +2263,98 @@ struct need_operator_in
             && !is_byte_type<T>::value;
 };
 
+template <class T>
+struct has_to_number
+{
+#ifdef ARGPARSE_HAS_FROM_CHARS
+    static bool const value = (is_integer_type<T>::value
+                               && has_operator_in<T>::value)
+                            || is_floating_point<T>::value;
+#else
+    static bool const value = is_integer_type<T>::value
+                            && has_operator_in<T>::value;
+#endif  // ARGPARSE_HAS_FROM_CHARS
+};
+
+template <class T>
+bool
+_to_number(
+        std::string const& data,
+        T& res,
+        typename enable_if<is_integer_type<T>::value
+                           && has_operator_in<T>::value, bool>::type = true)
+{
+#ifdef ARGPARSE_HAS_FROM_CHARS
+    char const* last = data.data() + data.size();
+    std::from_chars_result r = std::from_chars(data.data(), last, res);
+    return r.ec == std::errc() && r.ptr == last;
+#else
+    // plain decimal numbers only, let the stream handle the rest
+    bool const negative = !data.empty() && data.at(0) == '-';
+    if (negative && !std::numeric_limits<T>::is_signed) {
+        return false;
+    }
+    std::size_t i = negative ? 1 : 0;
+    if (i == data.size()) {
+        return false;
+    }
+    T value = T();
+    for ( ; i < data.size(); ++i) {
+        char const c = data.at(i);
+        if (c < '0' || c > '9') {
+            return false;
+        }
+        T const digit = static_cast<T>(c - '0');
+        if (negative) {
+            if (value < static_cast<T>(
+                    (std::numeric_limits<T>::min() + digit) / 10)) {
+                return false;
+            }
+            value = static_cast<T>(value * 10 - digit);
+        } else {
+            if (value > static_cast<T>(
+                    (std::numeric_limits<T>::max() - digit) / 10)) {
+                return false;
+            }
+            value = static_cast<T>(value * 10 + digit);
+        }
+    }
+    res = value;
+    return true;
+#endif  // ARGPARSE_HAS_FROM_CHARS
+}
+
+#ifdef ARGPARSE_HAS_FROM_CHARS
+template <class T>
+bool
+_to_number(
+        std::string const& data,
+        T& res,
+        typename enable_if<is_floating_point<T>::value, bool>::type = true)
+{
+    // streams don't accept 'inf' and 'nan' values
+    std::size_t const i = !data.empty() && data.at(0) == '-' ? 1 : 0;
+    if (i >= data.size()
+            || (!std::isdigit(static_cast<unsigned char>(data.at(i)))
+                && data.at(i) != '.')) {
+        return false;
+    }
+    char const* last = data.data() + data.size();
+    std::from_chars_result r = std::from_chars(data.data(), last, res);
+    return r.ec == std::errc() && r.ptr == last;
+}
+#endif  // ARGPARSE_HAS_FROM_CHARS
+
+template <class T>
+bool
+_to_number(
+        std::string const&,
+        T&,
+        typename enable_if<!has_to_number<T>::value, bool>::type = true)
+{
+    return false;
+}
+
 template <class T>
 T
 _to_type(
@@ -2179,6 +2386,20 @@ _to_type(
     return static_cast<T>(data.at(0));
 }
 
+template <class T>
+bool
+_try_to_type(
+        std::string const& data,
+        T& res)
+{
+    if (_to_number(data, res)) {
+        return true;
+    }
+    std::stringstream ss(data);
+    ss >> res;
+    return !ss.fail() && ss.eof();
+}
+
 template <class T>
 T
 _to_type(
@@ -2187,9 +2408,7 @@ _to_type(
                            && need_operator_in<T>::value, bool>::type = true)
 {
     T res = T();
-    std::stringstream ss(data);
-    ss >> res;
-    if (ss.fail() || !ss.eof()) {
+    if (!_try_to_type(data, res)) {
         throw
         TypeError("invalid " + Type::name<T>() + " value: '" + data + "'");
     }
@@ -2206,6 +2425,145 @@ _to_type(
     throw TypeError("unsupported type " + Type::name<T>());
 }
 
+// -- typed values ------------------------------------------------------------
+template <class T>
+struct is_typed_value
+{
+    static bool const value = (is_integer_type<T>::value
+                               || is_floating_point<T>::value)
+                            && has_operator_in<T>::value;
+};
+
+template <class T, bool = is_stl_array<T>::value
+                       || is_stl_container<T>::value
+                       || is_stl_queue<T>::value>
+struct typed_element
+{
+    typedef T type;
+};
+
+template <class T>
+struct typed_element<T, true>
+{
+    typedef typename T::value_type type;
+};
+
+template <class T>
+struct typed_tag
+{
+    static char const id;
+};
+
+template <class T>
+char const typed_tag<T>::id = 0;
+
+/**
+ *  @brief Values of the argument converted to the 'type' at parse time.
+ */
+class TypedValues
+{
+public:
+    virtual ~TypedValues() ARGPARSE_NOEXCEPT { }
+
+    virtual TypedValues*
+    clone() const = 0;
+
+    virtual void const*
+    tag() const ARGPARSE_NOEXCEPT = 0;
+
+    virtual std::string
+    type_name() const = 0;
+
+    virtual std::size_t
+    size() const ARGPARSE_NOEXCEPT = 0;
+
+    virtual void
+    clear() ARGPARSE_NOEXCEPT = 0;
+
+    virtual bool
+    push_back(std::string const& value) = 0;
+};
+
+template <class T>
+class TypedValuesImpl : public TypedValues
+{
+public:
+    TypedValuesImpl()
+        : TypedValues(),
+          m_values()
+    { }
+
+    TypedValues*
+    clone() const
+    {
+        return new TypedValuesImpl<T>(*this);
+    }
+
+    void const*
+    tag() const ARGPARSE_NOEXCEPT
+    {
+        return &typed_tag<T>::id;
+    }
+
+    std::string
+    type_name() const
+    {
+        return Type::basic<T>();
+    }
+
+    std::size_t
+    size() const ARGPARSE_NOEXCEPT
+    {
+        return m_values.size();
+    }
+
+    void
+    clear() ARGPARSE_NOEXCEPT
+    {
+        m_values.clear();
+    }
+
+    bool
+    push_back(std::string const& value)
+    {
+        T res = T();
+        if (!value.empty() && !_try_to_type(value, res)) {
+            return false;
+        }
+        m_values.push_back(res);
+        return true;
+    }
+
+    std::vector<T> const&
+    values() const ARGPARSE_NOEXCEPT
+    {
+        return m_values;
+    }
+
+private:
+    // -- data ----------------------------------------------------------------
+    std::vector<T> m_values;
+};
+
+template <class T>
+shared_ptr<TypedValues>
+_make_typed_values(
+        typename enable_if<is_typed_value<
+            typename typed_element<T>::type>::value, bool>::type = true)
+{
+    return shared_ptr<TypedValues>(
+                new TypedValuesImpl<typename typed_element<T>::type>());
+}
+
+template <class T>
+shared_ptr<TypedValues>
+_make_typed_values(
+        typename enable_if<!is_typed_value<
+            typename typed_element<T>::type>::value, bool>::type = true)
+{
+    return shared_ptr<TypedValues>();
+}
+
 template <class T>
 T
 _make_container(
@@ -2307,9 +2665,17 @@ _push_to_container(
     container.push_front(value);
 }
 
+// -- command line tokens -----------------------------------------------------
+// the parsed command line token, since C++17 a view into the arguments
+#ifdef ARGPARSE_HAS_STRING_VIEW
+typedef std::string_view token;
+#else
+typedef std::string token;
+#endif  // ARGPARSE_HAS_STRING_VIEW
+
 // -- colorstream -------------------------------------------------------------
-typedef std::pair<uint32_t, std::string> color_word;
-typedef std::list<color_word> color_text;
+// the color of the text from the offset to the next color span
+typedef std::pair<uint32_t, std::string::size_type> color_span;
 
 class colorstream
 {
@@ -2337,11 +2703,31 @@ public:
     operator <<(
             colorstream const& text);
 
+    colorstream&
+    fill(std::size_t count,
+            char c);
+
+    void
+    append(colorstream const& text,
+            std::size_t first,
+            std::size_t last);
+
     void
     print(std::ostream& os) const;
 
-    color_text const&
-    text() const;
+    bool
+    empty() const ARGPARSE_NOEXCEPT;
+
+    std::size_t
+    words() const ARGPARSE_NOEXCEPT;
+
+    std::string::size_type
+    word_begin(
+            std::size_t i) const;
+
+    std::string::size_type
+    word_end(
+            std::size_t i) const;
 
     bool
     colorize() const;
@@ -2352,8 +2738,8 @@ public:
     std::string
     reset_code() const;
 
-    std::string
-    str() const;
+    std::string const&
+    str() const ARGPARSE_NOEXCEPT;
 
     std::string
     colored() const;
@@ -2363,15 +2749,89 @@ private:
     can_colorize();
 
     // -- data ----------------------------------------------------------------
-    color_text m_text;
+    std::string m_str;
+    std::vector<color_span> m_spans;
     bool m_colorize;
 };
+
+// -- close matches -----------------------------------------------------------
+// the unmatched parts of the sequences in the gestalt pattern matching
+struct match_range
+{
+    match_range(
+            std::size_t a_lo,
+            std::size_t a_hi,
+            std::size_t b_lo,
+            std::size_t b_hi);
+
+    // -- data ----------------------------------------------------------------
+    std::size_t a_lo;
+    std::size_t a_hi;
+    std::size_t b_lo;
+    std::size_t b_hi;
+};
+
+/**
+ *  @brief Byte index of the possibilities for the close matches search.
+ *
+ *  Common bytes counts bound the gestalt ratio of the possibilities from
+ *  above, the exact ratio is computed only for the shortlisted ones.
+ */
+class CloseMatches
+{
+public:
+    CloseMatches();
+
+    explicit
+    CloseMatches(
+            std::vector<std::string> const& possibilities);
+
+    std::string
+    closest(std::string const& word,
+            float cutoff = 0.6f) const;
+
+private:
+    typedef std::pair<uint32_t, uint32_t> posting;
+
+    static bool
+    bound_greater(
+            std::pair<float, std::size_t> const& lhs,
+            std::pair<float, std::size_t> const& rhs);
+
+    // -- data ----------------------------------------------------------------
+    std::vector<std::string> m_possibilities;
+    // postings (possibility, count) of the byte are [offsets[c], offsets[c+1])
+    std::vector<std::size_t> m_offsets;
+    std::vector<posting> m_postings;
+};
 }  // namespace detail
 
 // Forward declaration
 class Argument;
 class ArgumentParser;
 
+namespace detail {
+class StorageData;
+
+typedef std::pair<shared_ptr<Argument>, StorageData> storage_value;
+
+/**
+ *  @brief Target variable of the argument, assigned after parsing.
+ */
+class Binder
+{
+public:
+    virtual ~Binder() ARGPARSE_NOEXCEPT { }
+
+    virtual void
+    store(std::string const& name,
+            storage_value const& value) const = 0;
+};
+
+template <class T>
+class BinderImpl;
+}  // namespace detail
+
 /**
  *  @brief A formatter for generating usage messages and help strings
  *  for arguments.
@@ -2551,8 +3011,12 @@ ARGPARSE_EXPORT class Argument
     friend class HelpFormatter;
     friend class MutuallyExclusiveGroup;
     friend class Namespace;
+    friend class ParsedArgument;
     friend class utils;
 
+    template <class T>
+    friend class detail::BinderImpl;
+
     enum Type ARGPARSE_ENUM_TYPE(uint8_t)
     {
         NoType      = 0x00,
@@ -2967,6 +3431,8 @@ public:
     /**
      *  @brief Set the 'type' name
      *  (for MetavarTypeHelpFormatter, Namespace::get/try_get\<T\> type check).
+     *  Integer and floating point values (or containers of them) are
+     *  converted at parse time, invalid values are reported as parse errors.
      *  @return A reference to the current argument.
      */
     template <class T>
@@ -2975,6 +3441,7 @@ public:
     type()
     {
         m_type_name = detail::Type::basic<T>();
+        m_typed = detail::_make_typed_values<T>();
         return *this;
     }
 
@@ -2999,17 +3466,43 @@ public:
     type(detail::func2<std::string const&, void*>::type func) ARGPARSE_NOEXCEPT;
 
     /**
-     *  @brief Set the 'choices' value.
-     *  @param value Choice value.
-     *  @since v1.7.1
+     *  @brief Bind the argument to the target variable. After parsing the
+     *  value of the argument is stored to the target like with
+     *  Namespace::get\<T\> (if the argument was processed or has a value).
+     *  For integer and floating point types (or containers of them)
+     *  the 'type' is also set (see Argument::type\<T\>).
+     *  ArgumentParser::parse_one and ArgumentParser::parse_many don't write
+     *  the target.
+     *  @param target Target variable (must outlive the argument parser usage).
+     *  @since v1.11.0
      *  @return A reference to the current argument.
      */
+    template <class T>
     ARGPARSE_ATTR_MAYBE_UNUSED
-    Argument&
-    choice(std::string const& value);
-
-    /**
-     *  @brief Set the 'choices' value. Each character is a separate choice.
+    inline Argument&
+    bind(T& target)
+    {
+        if (detail::is_typed_value<
+                typename detail::typed_element<T>::type>::value) {
+            type<T>();
+        }
+        m_binder = detail::shared_ptr<detail::Binder>(
+                    new detail::BinderImpl<T>(target));
+        return *this;
+    }
+
+    /**
+     *  @brief Set the 'choices' value.
+     *  @param value Choice value.
+     *  @since v1.7.1
+     *  @return A reference to the current argument.
+     */
+    ARGPARSE_ATTR_MAYBE_UNUSED
+    Argument&
+    choice(std::string const& value);
+
+    /**
+     *  @brief Set the 'choices' value. Each character is a separate choice.
      *  @param value Choices value.
      *  @return A reference to the current argument.
      */
@@ -3637,7 +4130,7 @@ private:
 
     void
     push_value(
-            std::string const& value,
+            detail::token const& value,
             std::vector<std::string>& values) const;
 
     std::string
@@ -3648,6 +4141,11 @@ private:
     is_match_name(
             std::string const& value) const;
 
+    bool
+    is_match_name(
+            std::string const& value,
+            std::vector<std::string> const& flags) const;
+
     bool
     operator ==(
             Argument const& rhs) const;
@@ -3667,12 +4165,15 @@ private:
     detail::Value<std::string>  m_implicit;
     detail::Value<std::string>  m_type_name;
     detail::Value<std::vector<std::string> > m_choices;
+    detail::shared_ptr<detail::hash_set<std::string>::type> m_choices_set;
     detail::SValue<detail::TranslationPack>  m_help;
     detail::Value<std::string>  m_version;
     detail::Value<std::vector<std::string> > m_metavar;
     std::vector<std::string>    m_dest;
     detail::func1<std::string const&>::type m_handle;
     detail::func2<std::string const&, void*>::type m_factory;
+    detail::shared_ptr<detail::TypedValues> m_typed;
+    detail::shared_ptr<detail::Binder> m_binder;
     detail::weak_ptr<_ArgumentData> m_post_trigger;
     uint16_t                    m_action;
     uint8_t                     m_type;
@@ -3691,15 +4192,63 @@ public:
     StorageData(
             std::vector<std::string> const& values);
 
+    StorageData(
+            StorageData const& orig);
+
+    StorageData&
+    operator =(
+            StorageData const& rhs);
+
+#ifdef ARGPARSE_CXX_11
+    StorageData(
+            StorageData&& orig) ARGPARSE_NOEXCEPT;
+
+    StorageData&
+    operator =(
+            StorageData&& rhs) ARGPARSE_NOEXCEPT;
+#endif  // C++11+
+
     void
     clear();
 
+    void
+    typed(shared_ptr<TypedValues> const& prototype);
+
+    template <class T>
+    std::vector<T> const*
+    typed_values(
+            typename enable_if<
+                is_typed_value<T>::value, bool>::type = true) const
+    {
+        if (!m_typed || m_typed->tag() != &typed_tag<T>::id
+                || m_typed->size() != m_values.size()) {
+            return ARGPARSE_NULLPTR;
+        }
+        return &static_cast<TypedValuesImpl<T> const*>(
+                    m_typed.get())->values();
+    }
+
+    template <class T>
+    std::vector<T> const*
+    typed_values(
+            typename enable_if<
+                !is_typed_value<T>::value, bool>::type = true) const
+    {
+        return ARGPARSE_NULLPTR;
+    }
+
     bool
     exists() const ARGPARSE_NOEXCEPT;
 
     bool
     is_default() const ARGPARSE_NOEXCEPT;
 
+    void
+    parsed(bool value) ARGPARSE_NOEXCEPT;
+
+    bool
+    is_parsed() const ARGPARSE_NOEXCEPT;
+
     std::vector<std::string> const&
     operator ()() const ARGPARSE_NOEXCEPT;
 
@@ -3715,31 +4264,39 @@ public:
     std::string const&
     at(std::size_t i) const;
 
-    void
+    bool
     push_back(
             std::string const& value,
             bool is_default = false);
 
-    void
+    bool
     push_values(
             std::vector<std::string> const& values);
 
     std::vector<std::size_t> const&
     indexes() const ARGPARSE_NOEXCEPT;
 
-    std::vector<std::string>
-    sub_values(
+    std::vector<std::string>::const_iterator
+    sub_begin(
             std::size_t i) const;
 
+    std::vector<std::string>::const_iterator
+    sub_end(std::size_t i) const;
+
 private:
+    bool
+    push_typed(
+            std::string const& value);
+
     // -- data ----------------------------------------------------------------
     bool m_exists;
     bool m_is_default;
+    bool m_is_parsed;
     std::vector<std::string> m_values;
     std::vector<std::size_t> m_indexes;
+    shared_ptr<TypedValues> m_typed;
 };
 
-typedef std::pair<shared_ptr<Argument>, StorageData> storage_value;
 typedef std::vector<std::string>::const_iterator     data_const_iterator;
 typedef std::vector<std::string>::difference_type    dtype;
 
@@ -3884,8 +4441,12 @@ _single_value(
     if (value.second.size() > 1) {
         throw TypeError("got a data-array for argument '" + key + "'");
     }
-    return value.second.empty()
-            ? T() : _as_type<T>(value.first, value.second.front());
+    if (value.second.empty()) {
+        return T();
+    }
+    std::vector<T> const* typed = value.second.template typed_values<T>();
+    return typed ? typed->front()
+                 : _as_type<T>(value.first, value.second.front());
 }
 
 template <class T>
@@ -3909,14 +4470,15 @@ template <class T>
 std::vector<T>
 _as_subvector(
         shared_ptr<Argument> const& key,
-        std::vector<std::string> const& vs,
+        data_const_iterator beg,
+        data_const_iterator end,
         uint8_t /*nargs*/,
         std::size_t /*num_args*/,
         typename enable_if<simple_element<T>::value, bool>::type = true)
 {
     std::vector<T> res;
-    res.reserve(vs.size());
-    for (data_const_iterator it = vs.begin(); it != vs.end(); ++it) {
+    res.reserve(static_cast<std::size_t>(end - beg));
+    for (data_const_iterator it = beg; it != end; ++it) {
         res.push_back(_as_type<T>(key, *it));
     }
     return res;
@@ -3926,13 +4488,15 @@ template <class T>
 std::vector<T>
 _as_subvector(
         shared_ptr<Argument> const& key,
-        std::vector<std::string> const& vs,
+        data_const_iterator beg,
+        data_const_iterator end,
         uint8_t nargs,
         std::size_t num_args,
         typename enable_if<!simple_element<T>::value, bool>::type = true)
 {
     std::vector<T> res;
-    if (vs.empty()) {
+    std::size_t const size = static_cast<std::size_t>(end - beg);
+    if (size == 0) {
         return res;
     }
     std::size_t st = 1;
@@ -3943,14 +4507,14 @@ _as_subvector(
     if (st == 0) {
         throw TypeError("unsupported argument with nargs=0");
     }
-    if (vs.size() % st != 0) {
+    if (size % st != 0) {
         throw ValueError("invalid stored argument amount");
     }
-    res.reserve(vs.size() / st);
-    for (std::size_t i = 0; i < vs.size(); i += st) {
+    res.reserve(size / st);
+    for (std::size_t i = 0; i < size; i += st) {
         std::vector<std::string> values(
-                    vs.begin() + static_cast<dtype>(i),
-                    vs.begin() + static_cast<dtype>(i + st));
+                    beg + static_cast<dtype>(i),
+                    beg + static_cast<dtype>(i + st));
         res.push_back(_as_type<T>(key, detail::_join(values)));
     }
     return res;
@@ -3963,7 +4527,12 @@ _get_vector(
         uint8_t nargs,
         std::size_t num_args)
 {
-    return _as_subvector<T>(value.first, value.second(), nargs, num_args);
+    std::vector<T> const* typed = value.second.template typed_values<T>();
+    if (typed) {
+        return *typed;
+    }
+    return _as_subvector<T>(value.first, value.second().begin(),
+                            value.second().end(), nargs, num_args);
 }
 
 template <class T>
@@ -3980,7 +4549,8 @@ _get_matrix(
     T res;
     for (std::size_t i = 0; i < value.second.indexes().size(); ++i) {
         std::vector<VV> vector = _as_subvector<VV>(
-                    value.first, value.second.sub_values(i), nargs, num_args);
+                    value.first, value.second.sub_begin(i),
+                    value.second.sub_end(i), nargs, num_args);
         _push_to_container<T>(res, _make_container<V>(vector));
     }
     return res;
@@ -4012,7 +4582,8 @@ _get_matrix(
     vec.reserve(size);
     for (std::size_t i = 0; i < size; ++i) {
         std::vector<VV> vector = _as_subvector<VV>(
-                    value.first, value.second.sub_values(i), nargs, num_args);
+                    value.first, value.second.sub_begin(i),
+                    value.second.sub_end(i), nargs, num_args);
         _push_to_container(vec, _make_container<V>(vector));
     }
     typedef typename std::vector<V>::difference_type dtype;
@@ -4235,6 +4806,63 @@ _get(std::string const& key,
           key, args.first, args.second().begin(), args.second().end(), sep);
 }
 #endif  // C++11+
+
+template <class T>
+struct is_separated_type
+{
+    static bool const value
+            = is_stl_container_paired<typename decay<T>::type>::value
+           || is_stl_container_tupled<typename decay<T>::type>::value
+           || is_stl_map<typename decay<T>::type>::value
+           || is_stl_pair<typename decay<T>::type>::value
+           || is_stl_tuple<typename decay<T>::type>::value;
+};
+
+template <class T>
+class BinderImpl : public Binder
+{
+public:
+    explicit
+    BinderImpl(
+            T& target)
+        : Binder(),
+          m_target(target)
+    { }
+
+    void
+    store(std::string const& name,
+            storage_value const& value) const
+    {
+        m_target = get<T>(name, value);
+    }
+
+private:
+    BinderImpl&
+    operator =(
+            BinderImpl const&);
+
+    template <class U>
+    static typename enable_if<!is_separated_type<U>::value, U>::type
+    get(std::string const& name,
+            storage_value const& value)
+    {
+        return _get<U>(name, value, value.first->m_type_name,
+                       value.first->m_default, value.first->m_nargs,
+                       value.first->m_num_args);
+    }
+
+    template <class U>
+    static typename enable_if<is_separated_type<U>::value, U>::type
+    get(std::string const& name,
+            storage_value const& value)
+    {
+        _check_non_count_action(name, value.first->action());
+        return _get<U>(name, value, value.first->m_type_name, _equal);
+    }
+
+    // -- data ----------------------------------------------------------------
+    T& m_target;
+};
 }  // namespace detail
 
 /**
@@ -4760,6 +5388,158 @@ private:
     std::list<MutuallyExclusiveGroup>& m_mutex_groups;
 };
 
+/**
+ *  @brief ArgumentKey class.
+ *  Handle of the argument for the fast Namespace lookup,
+ *  created with ArgumentParser::key.
+ *  @since v1.11.0
+ */
+ARGPARSE_EXPORT class ArgumentKey
+{
+    friend class ArgumentParser;
+    friend class ParsedArgument;
+    friend class _Storage;
+
+    explicit
+    ArgumentKey(
+            Argument const* argument,
+            std::size_t slot,
+            std::string const& name);
+
+public:
+    /**
+     *  @brief Construct empty argument key object.
+     *  @return Argument key object.
+     */
+    ArgumentKey();
+
+    /**
+     *  @brief Create an argument key object from another argument key.
+     *  @param orig Argument key object to copy.
+     */
+    ArgumentKey(
+            ArgumentKey const& orig);
+
+    /**
+     *  @brief Copy an argument key object from another argument key.
+     *  @param rhs Argument key object to copy.
+     *  @return A reference to the current argument key.
+     */
+    ArgumentKey&
+    operator =(
+            ArgumentKey const& rhs);
+
+    /**
+     *  @brief Get the argument name used to create the key.
+     *  @return Argument destination name or flag.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    std::string const&
+    name() const ARGPARSE_NOEXCEPT;
+
+private:
+    // -- data ----------------------------------------------------------------
+    Argument const* m_argument;
+    std::size_t m_slot;
+    std::string m_name;
+};
+
+/**
+ *  @brief Parsed argument of the Namespace object.
+ *  The object is valid for the lifetime of the Namespace object.
+ */
+ARGPARSE_EXPORT class ParsedArgument
+{
+    friend class Namespace;
+
+    explicit
+    ParsedArgument(
+            detail::storage_value const* data,
+            std::size_t slot);
+
+public:
+    /**
+     *  @brief Source of the argument values.
+     */
+    enum Source ARGPARSE_ENUM_TYPE(uint8_t)
+    {
+        NotSet      = 0x00,
+        Default     = 0x01,
+        CommandLine = 0x02
+    };
+
+    /**
+     *  @brief Create a parsed argument object from another parsed argument.
+     *  @param orig Parsed argument object to copy.
+     */
+    ParsedArgument(
+            ParsedArgument const& orig);
+
+    /**
+     *  @brief Copy a parsed argument object from another parsed argument.
+     *  @param rhs Parsed argument object to copy.
+     *  @return A reference to the current parsed argument.
+     */
+    ParsedArgument&
+    operator =(
+            ParsedArgument const& rhs);
+
+    /**
+     *  @brief Get the argument destination name.
+     *  @return Argument destination name.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    std::string const&
+    dest() const ARGPARSE_NOEXCEPT;
+
+    /**
+     *  @brief Get the argument.
+     *  @return Argument object.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    Argument const&
+    argument() const ARGPARSE_NOEXCEPT;
+
+    /**
+     *  @brief Get the argument key to use in the Namespace lookup.
+     *  @return Argument key.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    ArgumentKey
+    key() const;
+
+    /**
+     *  @brief Get the parsed string values of the argument.
+     *  @return Container with the parsed string values of the argument.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    std::vector<std::string> const&
+    values() const ARGPARSE_NOEXCEPT;
+
+    /**
+     *  @brief Check if the argument value is the default value.
+     *  @return True if the argument value is the default value,
+     *  otherwise false.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    bool
+    is_default() const ARGPARSE_NOEXCEPT;
+
+    /**
+     *  @brief Get the source of the argument values.
+     *  @return NotSet if the argument has no values, CommandLine if
+     *  the values are parsed from the command line, otherwise Default.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    Source
+    source() const ARGPARSE_NOEXCEPT;
+
+private:
+    // -- data ----------------------------------------------------------------
+    detail::storage_value const* m_data;
+    std::size_t m_slot;
+};
+
 /**
  *  @brief _Storage class.
  */
@@ -4767,13 +5547,20 @@ class _Storage
 {
     friend class ArgumentParser;
     friend class Namespace;
+    template <class T> friend class detail::CowValue;
 
     typedef detail::StorageData                     mapped_type;
     typedef detail::shared_ptr<Argument>            key_type;
     typedef detail::storage_value                   value_type;
-    typedef std::list<value_type>                   map_type;
+    typedef std::vector<value_type>                 map_type;
     typedef map_type::iterator                      iterator;
     typedef map_type::const_iterator                const_iterator;
+    typedef detail::hash_map<Argument const*, std::size_t>::type    slot_map;
+    typedef detail::hash_map<std::string, std::size_t>::type        name_map;
+    typedef detail::hash_map<
+                std::string, std::vector<std::size_t> >::type       flag_map;
+    typedef detail::hash_map<
+                Argument const*, std::vector<std::string> >::type   hide_map;
 
     _Storage();
 
@@ -4789,12 +5576,12 @@ class _Storage
     have_value(
             key_type const& key);
 
-    void
+    bool
     store_value(
             key_type const& key,
             std::string const& value);
 
-    void
+    bool
     store_values(
             key_type const& key,
             std::vector<std::string> const& values);
@@ -4830,7 +5617,7 @@ class _Storage
     erase(iterator it);
 
     iterator
-    begin() ARGPARSE_NOEXCEPT;
+    begin();
 
     iterator
     end() ARGPARSE_NOEXCEPT;
@@ -4841,6 +5628,9 @@ class _Storage
     const_iterator
     end() const ARGPARSE_NOEXCEPT;
 
+    bool
+    empty() const ARGPARSE_NOEXCEPT;
+
     const_iterator
     find_arg(
             std::string const& key) const;
@@ -4851,6 +5641,9 @@ class _Storage
     const_iterator
     find(key_type const& key) const;
 
+    const_iterator
+    find(ArgumentKey const& key) const;
+
     iterator
     find(key_type const& key);
 
@@ -4864,6 +5657,60 @@ class _Storage
             key_type const& key,
             std::vector<std::string> const& values);
 
+    std::vector<std::size_t> const&
+    dest_group(
+            key_type const& key);
+
+    void
+    update_slots();
+
+    void
+    update_names();
+
+    bool
+    names_indexed() const;
+
+    void
+    add_slot(
+            std::size_t slot);
+
+    const_iterator
+    find_slot(
+            Argument const* key) const;
+
+    std::vector<std::string> const&
+    argument_flags(
+            Argument const& arg) const;
+
+    std::vector<std::string> const&
+    visible_flags(
+            Argument const& arg) const;
+
+    bool
+    is_name(
+            Argument const& arg,
+            std::string const& key) const;
+
+    void
+    begin_update();
+
+    void
+    commit_update();
+
+    void
+    rollback_update();
+
+    void
+    save_slot(
+            std::size_t slot);
+
+    void
+    save_all();
+
+    const_iterator
+    slot_at(
+            std::size_t slot) const;
+
     // -- value conversion ----------------------------------------------------
     typedef std::vector<std::string>::const_iterator        data_const_iterator;
     typedef std::vector<std::string>::difference_type                     dtype;
@@ -4889,9 +5736,7 @@ class _Storage
         if constexpr (detail::has_operator_in<T>::value
                 && detail::need_operator_in<T>::value) {
             T res{};
-            std::stringstream ss(data);
-            ss >> res;
-            if (ss.fail() || !ss.eof()) {
+            if (!detail::_try_to_type(data, res)) {
                 return std::nullopt;
             }
             return res;
@@ -5049,16 +5894,18 @@ class _Storage
     static std::optional<std::vector<T> >
     as_opt_subvector(
             key_type const& key,
-            std::vector<std::string> const& vs)
+            data_const_iterator beg,
+            data_const_iterator end)
     {
         std::vector<T> res;
-        if (vs.empty()) {
+        std::size_t const size = static_cast<std::size_t>(end - beg);
+        if (size == 0) {
             return res;
         }
         if constexpr (detail::simple_element<T>::value) {
-            res.reserve(vs.size());
-            for (auto const& value : vs) {
-                auto el = as_opt_type<T>(key, value);
+            res.reserve(size);
+            for (auto it = beg; it != end; ++it) {
+                auto el = as_opt_type<T>(key, *it);
                 if (!el.has_value()) {
                     return std::nullopt;
                 }
@@ -5070,14 +5917,14 @@ class _Storage
                     && (key->m_nargs & detail::_NARGS_COMBINED)) {
                 st = key->m_num_args;
             }
-            if (st == 0 || vs.size() % st != 0) {
+            if (st == 0 || size % st != 0) {
                 return std::nullopt;
             }
-            res.reserve(vs.size() / st);
-            for (std::size_t i = 0; i < vs.size(); i += st) {
+            res.reserve(size / st);
+            for (std::size_t i = 0; i < size; i += st) {
                 std::vector<std::string> values(
-                            vs.begin() + static_cast<dtype>(i),
-                            vs.begin() + static_cast<dtype>(i + st));
+                            beg + static_cast<dtype>(i),
+                            beg + static_cast<dtype>(i + st));
                 auto el = as_opt_type<T>(key, detail::_join(values));
                 if (!el.has_value()) {
                     return std::nullopt;
@@ -5096,6 +5943,10 @@ class _Storage
         if (value.second.size() != 1) {
             return std::nullopt;
         }
+        auto typed = value.second.template typed_values<T>();
+        if (typed) {
+            return typed->front();
+        }
         return as_opt_type<T>(value.first, value.second.front());
     }
 
@@ -5104,10 +5955,15 @@ class _Storage
     opt_vector(
             value_type const& value)
     {
+        auto typed = value.second.template typed_values<T>();
+        if (typed) {
+            return *typed;
+        }
         std::vector<T> res;
         for (std::size_t i = 0; i < value.second.indexes().size(); ++i) {
             auto vector = as_opt_subvector<T>(
-                        value.first, value.second.sub_values(i));
+                        value.first, value.second.sub_begin(i),
+                        value.second.sub_end(i));
             if (!vector.has_value()) {
                 return std::nullopt;
             }
@@ -5127,7 +5983,8 @@ class _Storage
         T res;
         for (std::size_t i = 0; i < value.second.indexes().size(); ++i) {
             auto vector = as_opt_subvector<VV>(
-                        value.first, value.second.sub_values(i));
+                        value.first, value.second.sub_begin(i),
+                        value.second.sub_end(i));
             if (!vector.has_value()) {
                 return std::nullopt;
             }
@@ -5151,6 +6008,20 @@ class _Storage
 
     // -- data ----------------------------------------------------------------
     map_type m_data;
+    slot_map m_slots;
+    flag_map m_flags;
+    flag_map m_dests;
+    name_map m_names;
+    name_map m_match_names;
+    hide_map m_hidden_flags;
+    detail::hash_map<std::size_t, mapped_type>::type m_saved;
+    map_type m_saved_data;
+    hide_map m_saved_hidden;
+    std::size_t m_saved_size;
+    bool m_saved_all;
+    std::size_t m_names_version;
+    bool m_slots_valid;
+    bool m_names_valid;
 };
 
 /**
@@ -5159,27 +6030,29 @@ class _Storage
 ARGPARSE_EXPORT class Namespace
 {
     friend class ArgumentParser;
+    friend class ParseResult;
 
     explicit
     Namespace(
-            _Storage const& storage = _Storage(),
+            detail::CowValue<_Storage> const& storage
+                = detail::CowValue<_Storage>(),
             detail::func1<Namespace const&>::type const& fn = ARGPARSE_NULLPTR);
 
     explicit
     Namespace(
-            _Storage const& storage,
+            detail::CowValue<_Storage> const& storage,
             detail::func1<Namespace const&>::type const& func,
             std::vector<std::string> const& args);
 
 #ifdef ARGPARSE_CXX_11
     explicit
     Namespace(
-            _Storage&& storage,
+            detail::CowValue<_Storage>&& storage,
             detail::func1<Namespace const&>::type&& func) ARGPARSE_NOEXCEPT;
 
     explicit
     Namespace(
-            _Storage&& storage,
+            detail::CowValue<_Storage>&& storage,
             detail::func1<Namespace const&>::type&& func,
             std::vector<std::string>&& args) ARGPARSE_NOEXCEPT;
 #endif  // C++11+
@@ -5209,6 +6082,31 @@ public:
     bool
     exists(std::string const& key) const;
 
+    /**
+     *  @brief Check if the argument exists and is specified
+     *  in the parsed arguments.
+     *  @param key Argument key.
+     *  @since v1.11.0
+     *  @return True if the argument exists and is specified,
+     *  otherwise false.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    bool
+    contains(
+            ArgumentKey const& key) const;
+
+    /**
+     *  @brief Check if the argument exists and is specified
+     *  in the parsed arguments.
+     *  @param key Argument key.
+     *  @since v1.11.0
+     *  @return True if the argument exists and is specified,
+     *  otherwise false.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    bool
+    exists(ArgumentKey const& key) const;
+
     /**
      *  @brief Execute the parser function with the selected object.
      *  @param args Object with parsed arguments.
@@ -5226,6 +6124,15 @@ public:
     bool
     has_func() const ARGPARSE_NOEXCEPT;
 
+    /**
+     *  @brief Get the parsed arguments in the declaration order.
+     *  @since v1.11.0
+     *  @return Container with the parsed arguments.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    std::vector<ParsedArgument>
+    items() const;
+
     /**
      *  @brief Get the parsed value of the argument as boolean, byte,
      *  floating point, integer, stl span string, stl container,
@@ -5252,14 +6159,41 @@ public:
     }
 
     /**
-     *  @brief Get the parsed value of the argument as paired container types,
-     *  tupled container types, mapped types, paired types or tuple types. If
-     *  the argument was not processed, a default-constructed value is returned.
-     *  @param key Argument destination name or flag.
-     *  @param sep Separator (default: '=').
-     *  @return The parsed value of the argument.
-     */
-    template <class T>
+     *  @brief Get the parsed value of the argument as boolean, byte,
+     *  floating point, integer, stl span string, stl container,
+     *  2D stl containers or custom type. If the argument was not processed,
+     *  a default-constructed value is returned.
+     *  @param key Argument key.
+     *  @since v1.11.0
+     *  @return The parsed value of the argument.
+     */
+    template <class T>
+    ARGPARSE_ATTR_NODISCARD
+    typename detail::enable_if<
+        !detail::is_stl_container_paired<typename detail::decay<T>::type>::value
+     && !detail::is_stl_container_tupled<typename detail::decay<T>::type>::value
+     && !detail::is_stl_map<typename detail::decay<T>::type>::value
+     && !detail::is_stl_pair<typename detail::decay<T>::type>::value
+     && !detail::is_stl_tuple<typename detail::decay<T>::type>::value, T
+    >::type
+    get(ArgumentKey const& key) const
+    {
+        _Storage::value_type const& args = data(key);
+        return detail::_get<T>(
+                    key.name(), args, args.first->m_type_name,
+                    args.first->m_default, args.first->m_nargs,
+                    args.first->m_num_args);
+    }
+
+    /**
+     *  @brief Get the parsed value of the argument as paired container types,
+     *  tupled container types, mapped types, paired types or tuple types. If
+     *  the argument was not processed, a default-constructed value is returned.
+     *  @param key Argument destination name or flag.
+     *  @param sep Separator (default: '=').
+     *  @return The parsed value of the argument.
+     */
+    template <class T>
     ARGPARSE_ATTR_NODISCARD
     typename detail::enable_if<
         detail::is_stl_container_paired<typename detail::decay<T>::type>::value
@@ -5276,6 +6210,32 @@ public:
         return detail::_get<T>(key, args, args.first->m_type_name, sep);
     }
 
+    /**
+     *  @brief Get the parsed value of the argument as paired container types,
+     *  tupled container types, mapped types, paired types or tuple types. If
+     *  the argument was not processed, a default-constructed value is returned.
+     *  @param key Argument key.
+     *  @param sep Separator (default: '=').
+     *  @since v1.11.0
+     *  @return The parsed value of the argument.
+     */
+    template <class T>
+    ARGPARSE_ATTR_NODISCARD
+    typename detail::enable_if<
+        detail::is_stl_container_paired<typename detail::decay<T>::type>::value
+     || detail::is_stl_container_tupled<typename detail::decay<T>::type>::value
+     || detail::is_stl_map<typename detail::decay<T>::type>::value
+     || detail::is_stl_pair<typename detail::decay<T>::type>::value
+     || detail::is_stl_tuple<typename detail::decay<T>::type>::value, T
+    >::type
+    get(ArgumentKey const& key,
+            char sep = detail::_equal) const
+    {
+        _Storage::value_type const& args = data(key);
+        detail::_check_non_count_action(key.name(), args.first->action());
+        return detail::_get<T>(key.name(), args, args.first->m_type_name, sep);
+    }
+
     /**
      *  @brief Print namespace in the output stream.
      *  @param os Output stream (default: std::cout).
@@ -5331,8 +6291,149 @@ public:
         && !detail::is_stl_tuple<std::decay_t<T> >::value, T> >
     try_get(std::string const& key) const
     {
-        auto args = opt_data(key);
-        if (!args.has_value()) {
+        return opt_value<T>(find_data(key));
+    }
+
+    /**
+     *  @brief Try get the parsed value of the argument as boolean, byte,
+     *  floating point, integer, string, stl container, 2D stl container
+     *  or custom types. If the type is invalid, the argument does not exist,
+     *  was not parsed, or cannot be parsed, std::nullopt is returned.
+     *  @param key Argument key.
+     *  @since v1.11.0
+     *  @return The parsed value of the argument or std::nullopt.
+     */
+    template <class T>
+    ARGPARSE_ATTR_NODISCARD
+    std::optional<std::enable_if_t<
+        !detail::is_stl_container_paired<std::decay_t<T> >::value
+        && !detail::is_stl_container_tupled<std::decay_t<T> >::value
+        && !detail::is_stl_map<std::decay_t<T> >::value
+        && !detail::is_stl_pair<std::decay_t<T> >::value
+        && !detail::is_stl_tuple<std::decay_t<T> >::value, T> >
+    try_get(ArgumentKey const& key) const
+    {
+        return opt_value<T>(find_data(key));
+    }
+
+    /**
+     *  @brief Try get the parsed value of the argument as paired container,
+     *  tupled container, mapped, paired or tuple types.
+     *  If the type is invalid, the argument does not exist, was not parsed,
+     *  or cannot be parsed, std::nullopt is returned.
+     *  @param key Argument destination name or flag.
+     *  @param sep Separator (default: '=').
+     *  @return The parsed value of the argument or std::nullopt.
+     */
+    template <class T>
+    ARGPARSE_ATTR_NODISCARD
+    std::optional<std::enable_if_t<
+        detail::is_stl_container_paired<std::decay_t<T> >::value
+        || detail::is_stl_container_tupled<std::decay_t<T> >::value
+        || detail::is_stl_map<std::decay_t<T> >::value
+        || detail::is_stl_pair<std::decay_t<T> >::value
+        || detail::is_stl_tuple<std::decay_t<T> >::value, T> >
+    try_get(std::string const& key,
+            char sep = detail::_equal) const
+    {
+        return opt_value<T>(find_data(key), sep);
+    }
+
+    /**
+     *  @brief Try get the parsed value of the argument as paired container,
+     *  tupled container, mapped, paired or tuple types.
+     *  If the type is invalid, the argument does not exist, was not parsed,
+     *  or cannot be parsed, std::nullopt is returned.
+     *  @param key Argument key.
+     *  @param sep Separator (default: '=').
+     *  @since v1.11.0
+     *  @return The parsed value of the argument or std::nullopt.
+     */
+    template <class T>
+    ARGPARSE_ATTR_NODISCARD
+    std::optional<std::enable_if_t<
+        detail::is_stl_container_paired<std::decay_t<T> >::value
+        || detail::is_stl_container_tupled<std::decay_t<T> >::value
+        || detail::is_stl_map<std::decay_t<T> >::value
+        || detail::is_stl_pair<std::decay_t<T> >::value
+        || detail::is_stl_tuple<std::decay_t<T> >::value, T> >
+    try_get(ArgumentKey const& key,
+            char sep = detail::_equal) const
+    {
+        return opt_value<T>(find_data(key), sep);
+    }
+#endif  // ARGPARSE_HAS_OPTIONAL
+
+    /**
+     *  @brief Get the unrecognized arguments.
+     *  @return Container with the unrecognized arguments.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    std::vector<std::string> const&
+    unrecognized_args() const ARGPARSE_NOEXCEPT;
+
+    /**
+     *  @brief Get the unrecognized arguments as args string.
+     *  @return String with the unrecognized arguments.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    std::string
+    unrecognized_args_to_args() const;
+
+    /**
+     *  @brief Get the parsed string values of the argument without copying.
+     *  The reference is valid for the lifetime of the Namespace object.
+     *  @param key Argument destination name or flag.
+     *  @since v1.11.0
+     *  @return Container with the parsed string values of the argument.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    std::vector<std::string> const&
+    values_view(
+            std::string const& key) const;
+
+    /**
+     *  @brief Get the parsed string values of the argument without copying.
+     *  The reference is valid for the lifetime of the Namespace object.
+     *  @param key Argument key.
+     *  @since v1.11.0
+     *  @return Container with the parsed string values of the argument.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    std::vector<std::string> const&
+    values_view(
+            ArgumentKey const& key) const;
+
+private:
+    static std::string
+    store_actions_to_string(
+            _Storage::value_type const& args,
+            std::string const& quotes);
+
+    _Storage::value_type const&
+    data(std::string const& key) const;
+
+    _Storage::value_type const&
+    data(ArgumentKey const& key) const;
+
+    _Storage::value_type const*
+    find_data(
+            std::string const& key) const;
+
+    _Storage::value_type const*
+    find_data(
+            ArgumentKey const& key) const;
+
+    _Storage const&
+    storage() const ARGPARSE_NOEXCEPT;
+
+#ifdef ARGPARSE_HAS_OPTIONAL
+    template <class T>
+    std::optional<T>
+    opt_value(
+            _Storage::value_type const* args) const
+    {
+        if (!args) {
             return std::nullopt;
         }
         if constexpr (detail::has_value_type<T>::value
@@ -5367,7 +6468,7 @@ public:
                 }
                 return res;
             }
-            return _Storage::opt_single_value<T>(args.value());
+            return _Storage::opt_single_value<T>(*args);
         }
         if (args->first->action() == argparse::count) {
             return std::nullopt;
@@ -5379,7 +6480,7 @@ public:
                             | detail::ZERO_OR_MORE))) {
                 return std::nullopt;
             }
-            return _Storage::opt_matrix<T>(args.value());
+            return _Storage::opt_matrix<T>(*args);
         } else if constexpr (detail::is_stl_span<std::decay_t<T> >::value) {
             return detail::_make_container<T>(args->second());
         } else if constexpr ((detail::is_stl_container<std::decay_t<T> >::value
@@ -5390,7 +6491,7 @@ public:
                    || detail::is_stl_queue<std::decay_t<T> >::value)
                     && !detail::is_stl_matrix<std::decay_t<T> >::value)) {
             auto vector = _Storage::opt_vector<
-                    typename T::value_type>(args.value());
+                    typename T::value_type>(*args);
             if (!vector.has_value()) {
                 return std::nullopt;
             }
@@ -5400,35 +6501,20 @@ public:
                     || std::is_floating_point<T>::value
                     || std::is_same<bool, T>::value
                     || detail::is_byte_type<T>::value) {
-                return _Storage::opt_single_value<T>(args.value());
+                return _Storage::opt_single_value<T>(*args);
             } else {
-                return _Storage::opt_custom_value<T>(args.value());
+                return _Storage::opt_custom_value<T>(*args);
             }
         }
     }
 
-    /**
-     *  @brief Try get the parsed value of the argument as paired container,
-     *  tupled container, mapped, paired or tuple types.
-     *  If the type is invalid, the argument does not exist, was not parsed,
-     *  or cannot be parsed, std::nullopt is returned.
-     *  @param key Argument destination name or flag.
-     *  @param sep Separator (default: '=').
-     *  @return The parsed value of the argument or std::nullopt.
-     */
     template <class T>
-    ARGPARSE_ATTR_NODISCARD
-    std::optional<std::enable_if_t<
-        detail::is_stl_container_paired<std::decay_t<T> >::value
-        || detail::is_stl_container_tupled<std::decay_t<T> >::value
-        || detail::is_stl_map<std::decay_t<T> >::value
-        || detail::is_stl_pair<std::decay_t<T> >::value
-        || detail::is_stl_tuple<std::decay_t<T> >::value, T> >
-    try_get(std::string const& key,
-            char sep = detail::_equal) const
+    std::optional<T>
+    opt_value(
+            _Storage::value_type const* args,
+            char sep) const
     {
-        auto args = opt_data(key);
-        if (!args.has_value() || args->first->action() == argparse::count) {
+        if (!args || args->first->action() == argparse::count) {
             return std::nullopt;
         }
         if constexpr (detail::has_value_type<T>::value) {
@@ -5447,7 +6533,7 @@ public:
                 typename std::decay<T>::type>::value) {
             auto vector = _Storage::as_opt_vector_pair<
                     typename T::value_type::first_type,
-                    typename T::value_type::second_type>(args.value(), sep);
+                    typename T::value_type::second_type>(*args, sep);
             if (!vector.has_value()) {
                 return std::nullopt;
             }
@@ -5456,7 +6542,7 @@ public:
         if constexpr (detail::is_stl_container_tupled<
                 typename std::decay<T>::type>::value) {
             auto vector = _Storage::as_opt_vector_tuple<
-                    typename T::value_type>(args.value(), sep);
+                    typename T::value_type>(*args, sep);
             if (!vector.has_value()) {
                 return std::nullopt;
             }
@@ -5465,7 +6551,7 @@ public:
         if constexpr (detail::is_stl_map<typename std::decay<T>::type>::value) {
             T res{};
             auto vector = _Storage::as_opt_vector_pair<
-              typename T::key_type, typename T::mapped_type>(args.value(), sep);
+              typename T::key_type, typename T::mapped_type>(*args, sep);
             if (!vector.has_value()) {
                 return std::nullopt;
             }
@@ -5491,42 +6577,8 @@ public:
     }
 #endif  // ARGPARSE_HAS_OPTIONAL
 
-    /**
-     *  @brief Get the unrecognized arguments.
-     *  @return Container with the unrecognized arguments.
-     */
-    ARGPARSE_ATTR_NODISCARD
-    std::vector<std::string> const&
-    unrecognized_args() const ARGPARSE_NOEXCEPT;
-
-    /**
-     *  @brief Get the unrecognized arguments as args string.
-     *  @return String with the unrecognized arguments.
-     */
-    ARGPARSE_ATTR_NODISCARD
-    std::string
-    unrecognized_args_to_args() const;
-
-private:
-    static std::string
-    store_actions_to_string(
-            _Storage::value_type const& args,
-            std::string const& quotes);
-
-    _Storage::value_type const&
-    data(std::string const& key) const;
-
-    _Storage const&
-    storage() const ARGPARSE_NOEXCEPT;
-
-#ifdef ARGPARSE_HAS_OPTIONAL
-    std::optional<_Storage::value_type>
-    opt_data(
-            std::string const& key) const;
-#endif  // ARGPARSE_HAS_OPTIONAL
-
     // -- data ----------------------------------------------------------------
-    _Storage m_storage;
+    detail::CowValue<_Storage> m_storage;
     detail::func1<Namespace const&>::type m_func;
     detail::Value<std::vector<std::string> > m_unrecognized_args;
 };
@@ -5546,6 +6598,118 @@ operator <<(
     return os;
 }
 
+/**
+ *  @brief ParseResult class.
+ *  Result of the command line parsing with ArgumentParser::parse_one
+ *  and ArgumentParser::parse_many.
+ *  @since v1.11.0
+ */
+ARGPARSE_EXPORT class ParseResult
+{
+    friend class ArgumentParser;
+
+public:
+    /**
+     *  @brief Parse error code.
+     *  Help and Version codes are set if the help or version was requested,
+     *  the text is stored to the output instead of exit.
+     */
+    enum ErrorCode ARGPARSE_ENUM_TYPE(uint8_t)
+    {
+        NoError                 = 0x00,
+        UnrecognizedArguments   = 0x01,
+        InvalidChoice           = 0x02,
+        InvalidValue            = 0x03,
+        ExpectedArguments       = 0x04,
+        IgnoredExplicitArgument = 0x05,
+        AmbiguousOption         = 0x06,
+        NotAllowedArguments     = 0x07,
+        RequiredArguments       = 0x08,
+        FromfileError           = 0x09,
+        OtherError              = 0x0A,
+        Help                    = 0x0B,
+        Version                 = 0x0C
+    };
+
+    /**
+     *  @brief Construct empty parse result object.
+     *  @return Parse result object.
+     */
+    ParseResult();
+
+    /**
+     *  @brief Check if the command line was parsed.
+     *  @return True if the command line was parsed, otherwise false.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    bool
+    has_value() const ARGPARSE_NOEXCEPT;
+
+    /**
+     *  @brief Get the parsed arguments.
+     *  If the command line wasn't parsed, throws std::logic_error
+     *  with the parse error message.
+     *  @return Object with parsed arguments.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    Namespace const&
+    value() const;
+
+    /**
+     *  @brief Get the parse error message.
+     *  @return Parse error message or empty string if the command line
+     *  was parsed.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    std::string const&
+    error() const ARGPARSE_NOEXCEPT;
+
+    /**
+     *  @brief Get the parse error code.
+     *  @return Parse error code or NoError if the command line was parsed.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    ErrorCode
+    error_code() const ARGPARSE_NOEXCEPT;
+
+    /**
+     *  @brief Get the index of the command line argument with the error.
+     *  @return Index of the argument (after the fromfile arguments expansion)
+     *  or std::string::npos if the error isn't bound to the argument.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    std::size_t
+    error_index() const ARGPARSE_NOEXCEPT;
+
+    /**
+     *  @brief Get the key of the argument with the error.
+     *  @return Argument key or empty key if the error isn't bound
+     *  to the argument.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    ArgumentKey const&
+    error_argument() const ARGPARSE_NOEXCEPT;
+
+    /**
+     *  @brief Get the diagnostics output (usage and warnings) collected
+     *  while parsing the command line.
+     *  @return Diagnostics output.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    std::string const&
+    output() const ARGPARSE_NOEXCEPT;
+
+private:
+    // -- data ----------------------------------------------------------------
+    Namespace m_namespace;
+    std::string m_error;
+    std::string m_output;
+    ArgumentKey m_error_argument;
+    std::size_t m_error_index;
+    ErrorCode m_error_code;
+    bool m_has_value;
+};
+
 /**
  *  @brief _ParserGroup class.
  */
@@ -6301,6 +7465,7 @@ public:
         bool tmp = m_formatter->m_color;
         m_formatter = detail::make_shared<T>(value);
         m_formatter->m_color = tmp;
+        m_help_cache.clear();
         return *this;
     }
 
@@ -6335,6 +7500,41 @@ public:
     comment_prefix_chars(
             std::string const& value);
 
+    /**
+     *  @brief Set the 'fromfile_max_depth' value (default: 0, unlimited).
+     *  @param value Maximum nesting depth of fromfile arguments files.
+     *  @since v1.11.0
+     *  @return A reference to the current argument parser.
+     */
+    ARGPARSE_ATTR_MAYBE_UNUSED
+    ArgumentParser&
+    fromfile_max_depth(
+            std::size_t value) ARGPARSE_NOEXCEPT;
+
+    /**
+     *  @brief Set the 'fromfile_max_args' value (default: 0, unlimited).
+     *  @param value Maximum number of arguments after fromfile arguments
+     *  files expansion.
+     *  @since v1.11.0
+     *  @return A reference to the current argument parser.
+     */
+    ARGPARSE_ATTR_MAYBE_UNUSED
+    ArgumentParser&
+    fromfile_max_args(
+            std::size_t value) ARGPARSE_NOEXCEPT;
+
+    /**
+     *  @brief Set the 'fromfile_cache_size' value (default: 64).
+     *  @param value Maximum number of cached fromfile arguments files,
+     *  0 disables the cache.
+     *  @since v1.11.0
+     *  @return A reference to the current argument parser.
+     */
+    ARGPARSE_ATTR_MAYBE_UNUSED
+    ArgumentParser&
+    fromfile_cache_size(
+            std::size_t value) ARGPARSE_NOEXCEPT;
+
     /**
      *  @brief Set the 'argument_default' value.
      *  @param value Default argument value.
@@ -6559,6 +7759,33 @@ public:
     std::string const&
     comment_prefix_chars() const ARGPARSE_NOEXCEPT;
 
+    /**
+     *  @brief Get the 'fromfile_max_depth' (default: 0, unlimited).
+     *  @since v1.11.0
+     *  @return The 'fromfile_max_depth' value of the argument parser.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    std::size_t
+    fromfile_max_depth() const ARGPARSE_NOEXCEPT;
+
+    /**
+     *  @brief Get the 'fromfile_max_args' (default: 0, unlimited).
+     *  @since v1.11.0
+     *  @return The 'fromfile_max_args' value of the argument parser.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    std::size_t
+    fromfile_max_args() const ARGPARSE_NOEXCEPT;
+
+    /**
+     *  @brief Get the 'fromfile_cache_size' (default: 64).
+     *  @since v1.11.0
+     *  @return The 'fromfile_cache_size' value of the argument parser.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    std::size_t
+    fromfile_cache_size() const ARGPARSE_NOEXCEPT;
+
     /**
      *  @brief Get the 'argument_default'.
      *  @return The 'argument_default' value of the argument parser.
@@ -6819,6 +8046,19 @@ public:
     get_default(
             std::string const& dest) const;
 
+    /**
+     *  @brief Get the key of the argument for the fast access to the parsed
+     *  values with Namespace::get/try_get/contains.
+     *  Key lookup doesn't compare the argument names, if the argument was
+     *  removed from the parser the key falls back to the name lookup.
+     *  @param name Argument destination name or flag.
+     *  @since v1.11.0
+     *  @return Argument key.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    ArgumentKey
+    key(std::string const& name) const;
+
 #ifdef ARGPARSE_CXX_11
     /**
      *  @brief Set default values for a given arguments.
@@ -6854,6 +8094,33 @@ public:
     set_defaults_func(
             detail::func1<Namespace const&>::type func) ARGPARSE_NOEXCEPT;
 
+    /**
+     *  @brief Freeze the argument parser: prepare the parse plan once and
+     *  reuse it in the next parse calls (also freezes the subparsers).
+     *  Adding arguments, groups or subparsers to the parser drops the plan.
+     *  Call freeze() again after changing arguments, groups or subparsers
+     *  by their references.
+     *  Help and usage texts of the frozen parser are formatted once for each
+     *  language, output width and color.
+     *  Argument values are checked with the hash sets of the choices.
+     *  Choices and subparser names are indexed for suggestions, if
+     *  suggest_on_error is set before the freeze() call.
+     *  @since v1.11.0
+     *  @return A reference to the current argument parser.
+     */
+    ARGPARSE_ATTR_MAYBE_UNUSED
+    ArgumentParser&
+    freeze();
+
+    /**
+     *  @brief Check if the argument parser is frozen.
+     *  @since v1.11.0
+     *  @return True if the parse plan is prepared, false otherwise.
+     */
+    ARGPARSE_ATTR_NODISCARD
+    bool
+    frozen() const ARGPARSE_NOEXCEPT;
+
     /**
      *  @brief Parse command line arguments.
      *  @param space Namespace of parsed arguments (default: none).
@@ -6888,6 +8155,59 @@ public:
             std::vector<std::string> const& args,
             Namespace const& space = Namespace()) const;
 
+    /**
+     *  @brief Parse command line arguments of the main function.
+     *  Since C++17 the command line tokens are parsed as views into argv,
+     *  only the stored values are copied.
+     *  @param argc Number of command line arguments.
+     *  @param argv Command line arguments, the first one is skipped.
+     *  @param space Namespace of parsed arguments (default: none).
+     *  @since v1.11.0
+     *  @return Object with parsed arguments.
+     */
+    ARGPARSE_ATTR_MAYBE_UNUSED
+    Namespace
+    parse_args(
+            int argc,
+            char const* const argv[],
+            Namespace const& space = Namespace()) const;
+
+    /**
+     *  @brief Parse concrete arguments into the existing namespace.
+     *  Only the given arguments are changed: values of the store arguments
+     *  are replaced, other actions add to the namespace values.
+     *  For the namespace from the frozen parser the cost is proportional
+     *  to the number of given arguments, not to the number of declared ones.
+     *  If the arguments can't be parsed, the namespace is left unchanged.
+     *  @param args Arguments for parsing.
+     *  @param space Namespace of parsed arguments to update.
+     *  @since v1.11.0
+     *  @return A reference to the updated namespace.
+     */
+    ARGPARSE_ATTR_MAYBE_UNUSED
+    Namespace&
+    update_args(
+            std::string const& args,
+            Namespace& space) const;
+
+    /**
+     *  @brief Parse concrete arguments into the existing namespace.
+     *  Only the given arguments are changed: values of the store arguments
+     *  are replaced, other actions add to the namespace values.
+     *  For the namespace from the frozen parser the cost is proportional
+     *  to the number of given arguments, not to the number of declared ones.
+     *  If the arguments can't be parsed, the namespace is left unchanged.
+     *  @param args Arguments for parsing.
+     *  @param space Namespace of parsed arguments to update.
+     *  @since v1.11.0
+     *  @return A reference to the updated namespace.
+     */
+    ARGPARSE_ATTR_MAYBE_UNUSED
+    Namespace&
+    update_args(
+            std::vector<std::string> const& args,
+            Namespace& space) const;
+
     /**
      *  @brief Parse known command line arguments.
      *  @param space Namespace of parsed arguments (default: none).
@@ -6922,6 +8242,23 @@ public:
             std::vector<std::string> const& args,
             Namespace const& space = Namespace()) const;
 
+    /**
+     *  @brief Parse known command line arguments of the main function.
+     *  Since C++17 the command line tokens are parsed as views into argv,
+     *  only the stored values are copied.
+     *  @param argc Number of command line arguments.
+     *  @param argv Command line arguments, the first one is skipped.
+     *  @param space Namespace of parsed arguments (default: none).
+     *  @since v1.11.0
+     *  @return Object with parsed arguments.
+     */
+    ARGPARSE_ATTR_MAYBE_UNUSED
+    Namespace
+    parse_known_args(
+            int argc,
+            char const* const argv[],
+            Namespace const& space = Namespace()) const;
+
     /**
      *  @brief Parse intermixed command line arguments.
      *  @param space Namespace of parsed arguments (default: none).
@@ -7004,6 +8341,19 @@ public:
             std::initializer_list<std::string> const& args,
             Namespace const& space = Namespace()) const;
 
+    /**
+     *  @brief Parse concrete arguments into the existing namespace.
+     *  @param args Arguments for parsing.
+     *  @param space Namespace of parsed arguments to update.
+     *  @since v1.11.0
+     *  @return A reference to the updated namespace.
+     */
+    ARGPARSE_ATTR_MAYBE_UNUSED
+    Namespace&
+    update_args(
+            std::initializer_list<std::string> const& args,
+            Namespace& space) const;
+
     /**
      *  @brief Parse known concrete arguments.
      *  @param args Arguments for parsing.
@@ -7262,6 +8612,66 @@ public:
             Namespace const& space = Namespace()) const;
 #endif  // ARGPARSE_HAS_OPTIONAL
 
+    /**
+     *  @brief Parse the command line without throwing on the parse errors.
+     *  The parse error is stored in the parse result with the error code,
+     *  the argument index and the argument key, the errors and diagnostics
+     *  output are collected in the parse result.
+     *  @param command_line Command line for parsing.
+     *  @since v1.11.0
+     *  @return Parse result.
+     */
+    ARGPARSE_ATTR_MAYBE_UNUSED
+    ParseResult
+    parse_one(
+            std::string const& command_line) const;
+
+    /**
+     *  @brief Parse concrete arguments without throwing on the parse errors.
+     *  The parse error is stored in the parse result with the error code,
+     *  the argument index and the argument key, the errors and diagnostics
+     *  output are collected in the parse result.
+     *  @param args Arguments for parsing.
+     *  @since v1.11.0
+     *  @return Parse result.
+     */
+    ARGPARSE_ATTR_MAYBE_UNUSED
+    ParseResult
+    parse_one(
+            std::vector<std::string> const& args) const;
+
+    /**
+     *  @brief Parse many command lines.
+     *  Each command line is parsed like with parse_one, the errors
+     *  and diagnostics output are collected per command line.
+     *  @param command_lines Command lines for parsing.
+     *  @param jobs Number of parsing threads, 0 - hardware concurrency
+     *  (default: 1, C++11+).
+     *  @since v1.11.0
+     *  @return Parse results in the order of the command lines.
+     */
+    ARGPARSE_ATTR_MAYBE_UNUSED
+    std::vector<ParseResult>
+    parse_many(
+            std::vector<std::string> const& command_lines,
+            std::size_t jobs = 1) const;
+
+    /**
+     *  @brief Parse many concrete arguments.
+     *  Each arguments are parsed like with parse_one, the errors
+     *  and diagnostics output are collected per arguments.
+     *  @param args Arguments for parsing.
+     *  @param jobs Number of parsing threads, 0 - hardware concurrency
+     *  (default: 1, C++11+).
+     *  @since v1.11.0
+     *  @return Parse results in the order of the arguments.
+     */
+    ARGPARSE_ATTR_MAYBE_UNUSED
+    std::vector<ParseResult>
+    parse_many(
+            std::vector<std::vector<std::string> > const& args,
+            std::size_t jobs = 1) const;
+
     /**
      *  @brief Check if an environment variable with chosen name exists
      *  (from envp[]).
@@ -7390,12 +8800,76 @@ private:
     std::string
     default_language() const;
 
+    struct FlagIndex
+    {
+        // since C++17 the keys are views into the flags owned by the index,
+        // the command line tokens are found without copies
+        typedef detail::hash_map<detail::token, pArgument>::type flag_map;
+
+        explicit
+        FlagIndex(
+                pArguments const& optional,
+                pArguments const& operand);
+
+        void
+        add_flags(
+                flag_map& map,
+                pArguments const& arguments);
+
+        pArgument const
+        find(flag_map const& map,
+                detail::token const& flag) const;
+
+        struct Abbrev
+        {
+            std::string flag;
+            std::size_t option;
+            std::size_t index;
+            bool is_short;
+        };
+
+        static bool
+        abbrev_less(
+                Abbrev const& lhs,
+                Abbrev const& rhs);
+
+        static bool
+        abbrev_flag_less(
+                Abbrev const& lhs,
+                std::string const& flag);
+
+        static bool
+        abbrev_option_less(
+                Abbrev const* lhs,
+                Abbrev const* rhs);
+
+        void
+        build_abbrevs(
+                pArguments const& arguments) const;
+
+        void
+        find_abbrevs(
+                pArguments const& arguments,
+                std::string const& arg,
+                std::vector<Abbrev const*>& res) const;
+
+        // -- data ------------------------------------------------------------
+        detail::shared_ptr<std::deque<std::string> > keys;
+        flag_map optional;
+        flag_map operand;
+        // longer tokens are not flags, they are not copied for the lookup
+        std::size_t max_size;
+        mutable std::vector<Abbrev> abbrevs;
+        mutable std::vector<std::size_t> short_sizes;
+        mutable bool abbrevs_built;
+    };
+
     struct ParserInfo
     {
         explicit
         ParserInfo(
                 ArgumentParser const* parser,
-                _Storage const& storage,
+                detail::CowValue<_Storage> const& storage,
                 SubParsersInfo const& subparsers,
                 pArguments const& optional,
                 pArguments const& operand);
@@ -7407,14 +8881,175 @@ private:
         operator =(
                 ParserInfo const& rhs);
 
+        bool
+        failed() const ARGPARSE_NOEXCEPT;
+
+        void
+        error_index(
+                std::size_t index) const ARGPARSE_NOEXCEPT;
+
+        void
+        value_error_index(
+                std::size_t offset) const ARGPARSE_NOEXCEPT;
+
+        void
+        skip_values(
+                std::size_t count) ARGPARSE_NOEXCEPT;
+
         // -- data ------------------------------------------------------------
         ArgumentParser const* parser;
-        pArguments optional;
-        pArguments operand;
-        _Storage storage;
+        // shared by the copies, the parse plan info is copied on each parse
+        detail::shared_ptr<pArguments> optional;
+        detail::shared_ptr<pArguments> operand;
+        detail::shared_ptr<pArguments> required;
+        detail::shared_ptr<FlagIndex> flags;
+        detail::CowValue<_Storage> storage;
+        pArguments arguments;
         SubParsersInfo subparsers;
         std::string lang;
         bool has_negative_args;
+        std::ostream* err;
+        // parse errors are stored to the result instead of throwing
+        ParseResult* result;
+        // index of the next positional value in the command line, known
+        // only while the positional arguments are matched
+        std::size_t values_index;
+    };
+
+    typedef detail::shared_ptr<std::vector<std::string> > pFileArgs;
+
+    struct FromfileArgs
+    {
+        FromfileArgs();
+
+        // -- data ------------------------------------------------------------
+        int64_t mtime;
+        int64_t size;
+        pFileArgs args;
+        uint64_t used;
+    };
+
+    struct FromfileCache
+    {
+        FromfileCache();
+
+        FromfileCache(
+                FromfileCache const& orig);
+
+        FromfileCache&
+        operator =(
+                FromfileCache const& rhs);
+
+        pFileArgs
+        find(
+                std::string const& path,
+                int64_t mtime,
+                int64_t size);
+
+        void
+        insert(
+                std::string const& path,
+                int64_t mtime,
+                int64_t size,
+                pFileArgs const& args,
+                std::size_t limit);
+
+        // -- data ------------------------------------------------------------
+        detail::hash_map<std::string, FromfileArgs>::type files;
+        uint64_t uses;
+#ifdef ARGPARSE_CXX_11
+        mutable std::mutex mutex;
+#endif  // C++11+
+    };
+
+    // owns the tokens made while parsing (fromfile arguments, separated
+    // abbreviations), since C++17 the parsed tokens are views into them
+    struct TokenArena
+    {
+        TokenArena();
+
+        void
+        keep(std::vector<std::string>& values,
+                std::vector<detail::token>& res);
+
+        // -- data ------------------------------------------------------------
+        std::list<std::string> strings;
+        std::vector<pFileArgs> files;
+    };
+
+    struct HelpText
+    {
+        explicit
+        HelpText(
+                detail::colorstream const& text);
+
+        void
+        print(
+                std::ostream& os) const;
+
+        // -- data ------------------------------------------------------------
+        detail::colorstream text;
+        std::string colored;
+    };
+
+    typedef detail::shared_ptr<HelpText> pHelpText;
+
+    // rendered help and usage texts of the frozen parser
+    struct HelpCache
+    {
+        HelpCache();
+
+        HelpCache(
+                HelpCache const& orig);
+
+        HelpCache&
+        operator =(
+                HelpCache const& rhs);
+
+        pHelpText
+        find(
+                std::string const& key) const;
+
+        void
+        insert(
+                std::string const& key,
+                pHelpText const& text);
+
+        void
+        clear();
+
+        // -- data ------------------------------------------------------------
+        detail::hash_map<std::string, pHelpText>::type texts;
+#ifdef ARGPARSE_CXX_11
+        mutable std::mutex mutex;
+#endif  // C++11+
+    };
+
+    struct ParsePlan
+    {
+        typedef detail::shared_ptr<detail::CloseMatches> pMatches;
+        typedef detail::hash_map<Argument const*, pMatches>::type choices_map;
+
+        explicit
+        ParsePlan(
+                ParserInfo const& info,
+                pArguments const& positional,
+                _Storage const& storage);
+
+        detail::CloseMatches const*
+        find_choices(
+                Argument const* arg) const;
+
+        // -- data ------------------------------------------------------------
+        ParserInfo info;
+        pArguments positional;
+        _Storage storage;
+        pArguments suppressed;
+        pArguments bound;
+        // the choices and the subparser names close matches indices
+        // with suggest on error
+        choices_map choices;
+        detail::shared_ptr<detail::CloseMatches> parser_names;
     };
     typedef std::list<ParserInfo> Parsers;
     typedef std::list<ParserInfo>::iterator pi_iterator;
@@ -7422,7 +9057,7 @@ private:
     static ParserInfo
     parser_info(
             ArgumentParser const* parser,
-            _Storage const& storage,
+            detail::CowValue<_Storage> const& storage,
             SubParsersInfo const& subparsers);
 
     void
@@ -7431,16 +9066,29 @@ private:
             std::string const& lang = std::string(),
             std::ostream& os = std::cerr) const;
 
+    static void
+    report_error(
+            ParserInfo const& info,
+            ParseResult::ErrorCode code,
+            std::string const& message,
+            Argument const* arg = ARGPARSE_NULLPTR,
+            std::string const& lang = std::string());
+
     std::string
     despecify(
             std::string const& str) const;
 
+    pHelpText
+    help_text(
+            bool usage,
+            std::string const& language) const;
+
     void
     process_add_argument();
 
     Namespace
     on_parse_arguments(
-            std::vector<std::string> const& args,
+            std::vector<detail::token> args,
             bool only_known,
             bool intermixed,
             Namespace const& space) const;
@@ -7448,22 +9096,78 @@ private:
 #ifdef ARGPARSE_HAS_OPTIONAL
     std::optional<Namespace>
     on_try_parse_arguments(
-            std::vector<std::string> const& args,
+            std::vector<detail::token> args,
             bool only_known,
             bool intermixed,
             Namespace const& space) const;
 #endif  // ARGPARSE_HAS_OPTIONAL
 
-    std::vector<std::string>
+    void
+    try_parse_item(
+            std::vector<std::string> const& args,
+            ParseResult& res) const;
+
+    void
     read_args_from_file(
-            std::vector<std::string> const& arguments) const;
+            ParserInfo const& info,
+            std::vector<detail::token>& arguments,
+            TokenArena& arena) const;
+
+    void
+    expand_arg(
+            ParserInfo const& info,
+            detail::token const& arg,
+            std::vector<std::string>& files,
+            std::vector<detail::token>& res,
+            TokenArena& arena) const;
+
+    void
+    read_args_file(
+            ParserInfo const& info,
+            std::string const& file,
+            std::vector<std::string>& files,
+            std::vector<detail::token>& res,
+            TokenArena& arena) const;
+
+    pFileArgs
+    load_args_file(
+            ParserInfo const& info,
+            std::string const& file,
+            std::string const& path,
+            int64_t mtime,
+            int64_t size) const;
 
     Namespace
     parse_arguments(
-            std::vector<std::string> const& arguments,
+            std::vector<detail::token>& arguments,
             bool only_known,
             bool intermixed,
-            Namespace const& space) const;
+            Namespace const& space,
+            std::ostream& err = std::cerr,
+            ParseResult* result = ARGPARSE_NULLPTR) const;
+
+    Namespace&
+    update_arguments(
+            std::vector<detail::token>& arguments,
+            Namespace& space) const;
+
+    void
+    process_arguments(
+            std::vector<detail::token>& arguments,
+            bool only_known,
+            bool intermixed,
+            bool update,
+            Parsers& parsers,
+            std::vector<std::string>& unrecognized_args) const;
+
+    void
+    create_storage(
+            _Storage& storage) const;
+
+    void
+    restore_suppressed(
+            detail::CowValue<_Storage>& storage,
+            pArguments& suppressed) const;
 
     void
     check_namespace(
@@ -7481,15 +9185,21 @@ private:
     create_namespace(
             bool only_known,
             detail::func1<Namespace const&>::type func,
-            detail::rval<_Storage>::type storage,
+            detail::rval<detail::CowValue<_Storage> >::type storage,
             detail::rval<std::vector<std::string> >::type unrecognized_args);
 
     void
     validate_argument_value(
-            ArgumentParser const* parser,
+            ParserInfo const& info,
             Argument const& arg,
             std::string const& value) const;
 
+    static void
+    report_invalid_type(
+            ParserInfo const& info,
+            Argument const& arg,
+            std::vector<std::string> const& values);
+
     void
     storage_have_value(
             Parsers& parsers,
@@ -7527,39 +9237,39 @@ private:
     void
     storage_optional_store_func(
             Parsers& parsers,
-            std::string const& arg,
+            detail::token const& arg,
             pArgument const& tmp,
             std::size_t n) const;
 
     void
     storage_optional_store(
             Parsers& parsers,
-            std::vector<std::string> const& equals,
-            std::vector<std::string> const& args,
+            std::vector<detail::token> const& equals,
+            std::vector<detail::token> const& args,
             std::size_t& i,
             bool was_pseudo_arg,
-            std::string const& arg,
+            detail::token const& arg,
             pArgument const& tmp) const;
 
     void
     storage_optional_store_const(
             Parsers& parsers,
-            std::vector<std::string> const& equals,
-            std::string const& arg,
+            std::vector<detail::token> const& equals,
+            detail::token const& arg,
             pArgument const& tmp) const;
 
     void
     process_optional_help(
             ParserInfo const& info,
-            std::vector<std::string> const& equals,
-            std::string const& arg,
+            std::vector<detail::token> const& equals,
+            detail::token const& arg,
             pArgument const& tmp) const;
 
     void
     process_optional_version(
             ParserInfo const& info,
-            std::vector<std::string> const& equals,
-            std::string const& arg,
+            std::vector<detail::token> const& equals,
+            detail::token const& arg,
             pArgument const& tmp) const;
 
     void
@@ -7632,8 +9342,9 @@ private:
     check_abbreviations(
             Parsers const& parsers,
             bool was_pseudo_arg,
-            std::vector<std::string>& arguments,
-            std::size_t i) const;
+            std::vector<detail::token>& arguments,
+            std::size_t i,
+            TokenArena& arena) const;
 
     static bool
     is_remainder_positional(
@@ -7645,19 +9356,24 @@ private:
     get_optional_arg_by_flag(
             bool was_pseudo_arg,
             ParserInfo const& info,
-            std::string const& key);
+            detail::token const& key);
+
+    static bool
+    is_not_operand(
+            bool was_pseudo_arg,
+            ParserInfo const& info,
+            detail::token const& key);
 
     void
     separate_arg_abbrev(
             ParserInfo const& info,
             std::vector<std::string>& temp,
             std::string const& arg,
-            std::string const& name,
-            pArguments const& args) const;
+            std::string const& name) const;
 
     void
     process_positional_args(
-            std::vector<std::string> const& parsed_arguments,
+            std::vector<detail::token> const& parsed_arguments,
             std::size_t& i,
             Parsers& parsers,
             bool was_pseudo_arg,
@@ -7698,10 +9414,12 @@ private:
     check_required_args(
             Parsers& parsers,
             std::size_t& pos,
-            pArguments const& positional) const;
+            pArguments const& positional,
+            bool update) const;
 
     void
     check_unrecognized_args(
+            ParserInfo const& info,
             bool only_known,
             std::vector<std::string> const& args) const;
 
@@ -7709,6 +9427,23 @@ private:
     default_values_post_trigger(
             _Storage& storage) const;
 
+    static void
+    suppressed_post_trigger(
+            detail::CowValue<_Storage>& storage,
+            pArguments const& suppressed);
+
+    static void
+    bind_value(
+            detail::storage_value const& value);
+
+    static void
+    bind_values(
+            _Storage const& storage);
+
+    static void
+    bind_values(
+            Parsers const& parsers);
+
     static void
     namespace_post_trigger(
             Parsers& parsers,
@@ -7755,7 +9490,7 @@ private:
     parse_handle(
             bool only_known,
             detail::func1<Namespace const&>::type const& func,
-            _Storage const& storage,
+            detail::CowValue<_Storage> const& storage,
             std::vector<std::string> const& unrecognized_args) const;
 
     // -- data ----------------------------------------------------------------
@@ -7775,6 +9510,10 @@ private:
     std::string m_prefix_chars;
     std::string m_fromfile_prefix_chars;
     std::string m_comment_prefix_chars;
+    std::size_t m_fromfile_max_depth;
+    std::size_t m_fromfile_max_args;
+    std::size_t m_fromfile_cache_size;
+    mutable FromfileCache m_fromfile_cache;
     detail::SValue<std::string> m_argument_default;
     std::size_t m_output_width;
     std::list<pGroup> m_groups;
@@ -7791,6 +9530,8 @@ private:
     bool m_exit_on_error;
     bool m_suggest_on_error;
     bool m_deprecated;
+    detail::shared_ptr<ParsePlan> m_plan;
+    mutable HelpCache m_help_cache;
 };
 
 #ifdef ARGPARSE_ENABLE_UTILS
@@ -7980,6 +9721,7 @@ public:
 namespace detail {
 ARGPARSE_INLINE_VARIABLE std::size_t ARGPARSE_USE_CONSTEXPR _def_width     = 80;
 ARGPARSE_INLINE_VARIABLE std::size_t ARGPARSE_USE_CONSTEXPR _min_width     = 33;
+ARGPARSE_INLINE_VARIABLE std::size_t ARGPARSE_USE_CONSTEXPR _cached_files  = 64;
 ARGPARSE_INLINE_VARIABLE char ARGPARSE_USE_CONSTEXPR _prefix_char         = '-';
 ARGPARSE_INLINE_VARIABLE char ARGPARSE_USE_CONSTEXPR _prefix_chars[]      = "-";
 ARGPARSE_INLINE_VARIABLE char ARGPARSE_USE_CONSTEXPR _pseudo_arg[]       = "--";
@@ -8250,34 +9992,54 @@ _utf8_codepoint_size(
 
 ARGPARSE_INL std::pair<bool, std::size_t>
 _utf8_length(
-        std::string const& str,
+        char const* begin,
+        char const* end,
         std::ostream& err = std::cerr)
 {
+    std::size_t const str_size = static_cast<std::size_t>(end - begin);
+    // the high bit of each byte of the word
+    std::size_t const ascii_mask = ~static_cast<std::size_t>(0) / 0xFF * 0x80;
     std::size_t res = 0;
     std::size_t i = 0;
-    while (i < str.size()) {
-        std::size_t cp_size = _utf8_codepoint_size(_char_to_u8(str.at(i)));
+    while (i < str_size) {
+        // skip the ASCII text a word at a time
+        while (str_size - i >= sizeof(std::size_t)) {
+            std::size_t word;
+            std::memcpy(&word, begin + i, sizeof(std::size_t));
+            if (word & ascii_mask) {
+                break;
+            }
+            i += sizeof(std::size_t);
+            res += sizeof(std::size_t);
+        }
+        if (i == str_size) {
+            break;
+        }
+        std::size_t cp_size = _utf8_codepoint_size(_char_to_u8(begin[i]));
         if (cp_size == 0) {
             err << "argparse error [skip]: invalid code point for string "
-                << "'" << str << "'" << std::endl;
-            return std::make_pair(false, str.size());
+                << "'" << std::string(begin, end) << "'" << std::endl;
+            return std::make_pair(false, str_size);
         }
-        if (i + cp_size > str.size()) {
+        if (i + cp_size > str_size) {
             err << "argparse error [skip]: code point for string '"
-                << str << "' would be out of bounds" << std::endl;
-            return std::make_pair(false, str.size());
+                << std::string(begin, end) << "' would be out of bounds"
+                << std::endl;
+            return std::make_pair(false, str_size);
         }
         for (std::size_t n = 1; n < cp_size; ++n) {
-            if (str.at(i + n) == '\0') {
-                err << "argparse error [skip]: string '" << str << "' "
+            if (begin[i + n] == '\0') {
+                err << "argparse error [skip]: string '"
+                    << std::string(begin, end) << "' "
                     << "is NUL-terminated in the middle of the code point"
                     << std::endl;
-                return std::make_pair(false, str.size());
-            } else if ((_char_to_u8(str.at(i + n)) & _utf8_ct_mask)
-                                                  != _utf8_ct_bits) {
+                return std::make_pair(false, str_size);
+            } else if ((_char_to_u8(begin[i + n]) & _utf8_ct_mask)
+                                                 != _utf8_ct_bits) {
                 err << "argparse error [skip]: invalid byte in code point"
-                    << " for string '" << str << "'" << std::endl;
-                return std::make_pair(false, str.size());
+                    << " for string '" << std::string(begin, end) << "'"
+                    << std::endl;
+                return std::make_pair(false, str_size);
             }
         }
         i += cp_size;
@@ -8286,6 +10048,14 @@ _utf8_length(
     return std::make_pair(true, res);
 }
 
+ARGPARSE_INL std::pair<bool, std::size_t>
+_utf8_length(
+        std::string const& str,
+        std::ostream& err = std::cerr)
+{
+    return _utf8_length(str.data(), str.data() + str.size(), err);
+}
+
 // since v1.7.3
 ARGPARSE_INL bool
 _is_utf8_string(
@@ -8779,6 +10549,66 @@ _get_terminal_size(
     return std::make_pair(width, height);
 }
 
+ARGPARSE_INL bool
+_file_stat(
+        std::string const& file,
+        std::string& path,
+        int64_t& mtime,
+        int64_t& size)
+{
+#if defined(_WIN32)
+    struct _stat st;
+    if (_stat(file.c_str(), &st) != 0) {
+        return false;
+    }
+    char buf[MAX_PATH];
+    DWORD len = GetFullPathNameA(file.c_str(), MAX_PATH, buf, ARGPARSE_NULLPTR);
+    path = len > 0 && len < MAX_PATH ? std::string(buf, len) : file;
+#else  // UNIX
+    struct stat st;
+    if (stat(file.c_str(), &st) != 0) {
+        return false;
+    }
+    char* real = realpath(file.c_str(), ARGPARSE_NULLPTR);
+    if (real) {
+        path = real;
+        free(real);
+    } else {
+        path = file;
+    }
+#endif  // _WIN32
+    // modification time in nanoseconds (where available)
+#if defined(__APPLE__)
+    mtime = static_cast<int64_t>(st.st_mtimespec.tv_sec) * 1000000000
+            + static_cast<int64_t>(st.st_mtimespec.tv_nsec);
+#elif defined(__linux__)
+    mtime = static_cast<int64_t>(st.st_mtim.tv_sec) * 1000000000
+            + static_cast<int64_t>(st.st_mtim.tv_nsec);
+#else
+    mtime = static_cast<int64_t>(st.st_mtime) * 1000000000;
+#endif  // __APPLE__
+    size = static_cast<int64_t>(st.st_size);
+#if defined(_WIN32)
+    if ((st.st_mode & _S_IFMT) != _S_IFREG) {
+#else  // UNIX
+    if (!S_ISREG(st.st_mode)) {
+#endif  // _WIN32
+        // pipes, FIFOs and devices have no size
+        size = -1;
+    }
+    return true;
+}
+
+ARGPARSE_INL bool
+_file_recently_modified(
+        int64_t mtime)
+{
+    // file system timestamps are coarse (up to 2 seconds), the file can be
+    // changed again with the same modification time
+    int64_t const now = static_cast<int64_t>(time(ARGPARSE_NULLPTR));
+    return mtime / 1000000000 + 2 > now;
+}
+
 ARGPARSE_INL void
 _limit_to_min(
         std::size_t& value,
@@ -8898,6 +10728,42 @@ _has_quotes(
             && (str.at(0) == '\'' || str.at(0) == '\"');
 }
 
+#ifdef ARGPARSE_HAS_STRING_VIEW
+ARGPARSE_INL std::string
+_token_str(
+        token str)
+{
+    return std::string(str);
+}
+#else
+ARGPARSE_INL std::string const&
+_token_str(
+        token const& str)
+{
+    return str;
+}
+#endif  // ARGPARSE_HAS_STRING_VIEW
+
+ARGPARSE_INL std::vector<token>
+_tokens(std::vector<std::string> const& args)
+{
+    return std::vector<token>(args.begin(), args.end());
+}
+
+ARGPARSE_INL std::vector<token>
+_tokens(int argc,
+        char const* const argv[])
+{
+    std::vector<token> res;
+    if (argc > 0 && argv && argv[0]) {
+        res.reserve(std::size_t(argc - 1));
+        for (int i = 1; i < argc && argv[i]; ++i) {
+            res.push_back(token(argv[i]));
+        }
+    }
+    return res;
+}
+
 ARGPARSE_INL std::string
 _remove_quotes(
         std::string const& str)
@@ -8919,6 +10785,28 @@ _replace(
     return str;
 }
 
+#ifdef ARGPARSE_CXX_11
+// the next "%(name)s" format specifier (name is [a-z_]*) from the position
+ARGPARSE_INL std::pair<std::string::size_type, std::string::size_type>
+_find_specifier(
+        std::string const& str,
+        std::string::size_type pos)
+{
+    for (pos = str.find("%(", pos); pos != std::string::npos;
+         pos = str.find("%(", pos + 1)) {
+        std::string::size_type end = pos + 2;
+        while (end < str.size() && (('a' <= str[end] && str[end] <= 'z')
+                                    || str[end] == '_')) {
+            ++end;
+        }
+        if (str.compare(end, 2, ")s") == 0) {
+            return std::make_pair(pos, end + 2);
+        }
+    }
+    return std::make_pair(std::string::npos, std::string::npos);
+}
+#endif  // C++11+
+
 ARGPARSE_INL bool
 _contains_substr(
         std::string const& str,
@@ -9000,17 +10888,17 @@ _is_flag_correct(
 
 ARGPARSE_INL bool
 _is_negative_number(
-        std::string const& str)
+        token const& str)
 {
     double value;
-    std::stringstream ss(str);
+    std::stringstream ss(_token_str(str));
     ss >> value;
     return !ss.fail() && ss.eof() && value < 0;
 }
 
 ARGPARSE_INL bool
 _is_optional(
-        std::string const& arg,
+        token const& arg,
         std::string const& prefix_chars,
         bool has_negative_args,
         bool was_pseudo_arg)
@@ -9021,7 +10909,7 @@ _is_optional(
 
 ARGPARSE_INL bool
 _not_optional(
-        std::string const& arg,
+        token const& arg,
         std::string const& prefix_chars,
         bool has_negative_args,
         bool was_pseudo_arg)
@@ -9122,26 +11010,36 @@ _split_lines(
     return res;
 }
 
-ARGPARSE_INL std::vector<std::string>
-_split_equal(
-        std::string const& str,
+ARGPARSE_INL std::string::size_type
+_equal_position(
+        token const& str,
         std::string const& prefix)
 {
-    std::string::size_type pos;
     if (_exists(_equal, prefix)) {
-        std::string::const_iterator it = str.begin();
+        token::const_iterator it = str.begin();
         for ( ; it != str.end() && *it == _equal; ++it) {
         }
-        pos = str.find(_equal, static_cast<std::string::size_type>(
-                           std::distance(str.begin(), it)));
-    } else {
-        pos = str.find(_equal);
+        return str.find(_equal, static_cast<std::string::size_type>(
+                            std::distance(str.begin(), it)));
     }
+    return str.find(_equal);
+}
+
+ARGPARSE_INL std::vector<std::string>
+_split_equal(
+        std::string const& str,
+        std::string const& prefix)
+{
+    std::string::size_type const pos = _equal_position(str, prefix);
+    std::vector<std::string> res;
     if (pos != std::string::npos) {
-        return _vector(str.substr(0, pos), str.substr(pos + 1));
+        res.reserve(2);
+        res.push_back(str.substr(0, pos));
+        res.push_back(str.substr(pos + 1));
     } else {
-        return _vector(str);
+        res.push_back(str);
     }
+    return res;
 }
 
 ARGPARSE_INL void
@@ -9277,10 +11175,11 @@ _boolean_option_to_string(
 
 ARGPARSE_INL std::string
 _ignore_explicit(
-        std::string const& arg,
-        std::string const& value)
+        token const& arg,
+        token const& value)
 {
-    return "argument " + arg + ": ignored explicit argument '" + value + "'";
+    return "argument " + _token_str(arg) + ": ignored explicit argument '"
+            + _token_str(value) + "'";
 }
 
 // -- ColorType ---------------------------------------------------------------
@@ -9317,7 +11216,7 @@ _add_arg_usage(
         colorstream const& str,
         bool required)
 {
-    if (!ss.text().empty()) {
+    if (!ss.empty()) {
         ss << clr_reset << "\n";
     }
     if (required) {
@@ -9334,7 +11233,9 @@ _format_output_func(
         colorstream& res,
         std::size_t& head_size,
         std::size_t& size,
-        colorstream& tmp,
+        colorstream const& cs,
+        std::size_t first,
+        std::size_t last,
         std::size_t& word_size)
 {
     if (size > indent && size + 1 + word_size + head_size > width) {
@@ -9343,14 +11244,13 @@ _format_output_func(
         head_size = 0;
     }
     if (size + head_size < indent) {
-        res << clr_reset << std::string(indent - size - head_size, _space);
+        (res << clr_reset).fill(indent - size - head_size, _space);
         size = indent - head_size;
     } else {
         res << clr_reset << _spaces;
         ++size;
     }
-    res << tmp;
-    tmp.clear();
+    res.append(cs, first, last);
     size += word_size;
     word_size = 0;
 }
@@ -9371,18 +11271,22 @@ _format_output(
     }
     std::size_t size = 0;
     std::size_t word = 0;
-    colorstream tmp;
-    for (std::list<color_word>::const_iterator it = cs.text().begin();
-         it != cs.text().end(); ++it) {
-        std::string const& str = (*it).second;
-        if (str == "\n") {
-            _format_output_func(indent, width, res, head_size, size, tmp, word);
+    // the words of the text are copied to the result at the line breaks
+    std::size_t first = 0;
+    char const* text = cs.str().data();
+    for (std::size_t i = 0; i < cs.words(); ++i) {
+        std::string::size_type const begin = cs.word_begin(i);
+        std::string::size_type const end = cs.word_end(i);
+        if (end - begin == 1 && text[begin] == '\n') {
+            _format_output_func(indent, width, res, head_size, size,
+                                cs, first, i, word);
+            first = i + 1;
         } else {
-            tmp << (*it).first << str;
-            word += _utf8_length(str).second;
+            word += _utf8_length(text + begin, text + end).second;
         }
     }
-    _format_output_func(indent, width, res, head_size, size, tmp, word);
+    _format_output_func(indent, width, res, head_size, size,
+                        cs, first, cs.words(), word);
     return res;
 }
 
@@ -9459,6 +11363,39 @@ _is_type_correct(
     return expected.empty() || received == expected;
 }
 
+#ifdef ARGPARSE_CXX_11
+typedef std::atomic<std::size_t> _version_counter;
+#else
+typedef std::size_t _version_counter;
+#endif  // C++11+
+
+ARGPARSE_INL _version_counter&
+_names_counter() ARGPARSE_NOEXCEPT
+{
+    static _version_counter counter(0);
+    return counter;
+}
+
+ARGPARSE_INL std::size_t
+_names_version() ARGPARSE_NOEXCEPT
+{
+    return _names_counter();
+}
+
+ARGPARSE_INL void
+_names_changed() ARGPARSE_NOEXCEPT
+{
+    ++_names_counter();
+}
+
+ARGPARSE_INL shared_ptr<hash_set<std::string>::type>
+_choices_set(
+        std::vector<std::string> const& choices)
+{
+    return make_shared<hash_set<std::string>::type>(
+                hash_set<std::string>::type(choices.begin(), choices.end()));
+}
+
 ARGPARSE_INL void
 _check_type(
         Value<std::string> const& expected,
@@ -9541,27 +11478,6 @@ _update_flag_name(
     }
 }
 
-ARGPARSE_INL pArgument const
-_find_arg_by_flag(
-        pArguments const& args,
-        std::string const& key)
-{
-    pArguments::const_iterator it = args.begin();
-    for ( ; it != args.end() && !_exists(key, (*it)->flags()); ++it) {
-    }
-    return it != args.end() ? *it : ARGPARSE_NULLPTR;
-}
-
-ARGPARSE_INL bool
-_is_not_operand(
-        bool was_pseudo_arg,
-        pArguments const& args,
-        std::string const& key)
-{
-    return was_pseudo_arg || !_find_arg_by_flag(
-                args, _split(key, _equals, 1).front());
-}
-
 ARGPARSE_INL void
 _check_intermixed_subparsers(
         bool intermixed,
@@ -9573,18 +11489,23 @@ _check_intermixed_subparsers(
     }
 }
 
-ARGPARSE_INL std::vector<std::string>
+ARGPARSE_INL token const&
 _process_split_equal(
-        std::string& arg,
-        std::string const& prefix_chars)
+        token const& arg,
+        std::string const& prefix_chars,
+        std::vector<token>& equals)
 {
-    std::vector<std::string> equals = _split_equal(arg, prefix_chars);
-    if (equals.size() == 2 && !equals.front().empty()) {
-        arg = equals.front();
-    } else {
-        equals.resize(1);
+    // equals stays empty for a token without an explicit argument,
+    // so the common case doesn't copy the token
+    equals.clear();
+    std::string::size_type const pos = _equal_position(arg, prefix_chars);
+    if (pos == std::string::npos || pos == 0) {
+        return arg;
     }
-    return equals;
+    equals.reserve(2);
+    equals.push_back(arg.substr(0, pos));
+    equals.push_back(arg.substr(pos + 1));
+    return equals.front();
 }
 
 ARGPARSE_INL bool
@@ -9612,7 +11533,7 @@ _process_separate_arg_abbrev(
         std::size_t cp_size,
         std::vector<std::string>& flags,
         std::string const& arg,
-        pArguments const& args)
+        hash_map<token, pArgument>::type const& args)
 {
     std::string abbrev = name.substr(i, cp_size);
     if (abbrev == _equals) {
@@ -9623,17 +11544,11 @@ _process_separate_arg_abbrev(
         return false;
     }
     Argument const* argument = ARGPARSE_NULLPTR;
-    for (std::size_t j = 0; j < args.size() && !argument; ++j) {
-        for (std::size_t k = 0; k < args.at(j)->flags().size(); ++k) {
-            std::string const& flag = args.at(j)->flags().at(k);
-            if (_utf8_length(flag).second == 2
-                    && flag.substr(1) == abbrev
-                    && flag.at(0) == arg.at(0)) {
-                flags.push_back(flag);
-                argument = args.at(j).get();
-                break;
-            }
-        }
+    std::string const flag = arg.at(0) + abbrev;
+    hash_map<token, pArgument>::type::const_iterator it = args.find(flag);
+    if (it != args.end() && _utf8_length(flag).second == 2) {
+        flags.push_back(flag);
+        argument = it->second.get();
     }
     if (!argument && flags.empty()) {
         flags.push_back(arg);
@@ -9651,51 +11566,79 @@ _process_separate_arg_abbrev(
     return true;
 }
 
+ARGPARSE_INL
+match_range::match_range(
+        std::size_t a_lo,
+        std::size_t a_hi,
+        std::size_t b_lo,
+        std::size_t b_hi)
+    : a_lo(a_lo),
+      a_hi(a_hi),
+      b_lo(b_lo),
+      b_hi(b_hi)
+{ }
+
+// Ratcliff/Obershelp: the longest common block, then the parts around it
 ARGPARSE_INL std::size_t
 _match_pattern(
-        std::string const& a,
-        std::size_t left,
-        std::string const& b,
-        std::size_t right)
-{
-    std::size_t i, j, k, m;
-    std::size_t length = 0;
-    std::size_t leftReset = 0;
-    std::size_t rightReset = 0;
-
-    for (i = 0; i < left - length; ++i) {
-        for (j = 0; j < right - length; ++j) {
-            if (a.at(i) == b.at(j)
-                    && i + length < a.size()
-                    && j + length < b.size()
-                    && a.at(i + length) == b.at(j + length)) {
-                for (k = i + 1, m = j + 1;
-                  k < a.size() && m < b.size() && a.at(k) == b.at(m); ++k, ++m);
-
-                if (k > length + i) {
-                    leftReset = i;
-                    rightReset = j;
-                    length = k - i;
+        char const* a,
+        std::size_t a_size,
+        char const* b,
+        std::size_t b_size,
+        std::vector<match_range>& ranges)
+{
+    std::size_t res = 0;
+    ranges.clear();
+    ranges.push_back(match_range(0, a_size, 0, b_size));
+    while (!ranges.empty()) {
+        match_range const r = ranges.back();
+        ranges.pop_back();
+        std::size_t length = 0;
+        std::size_t i_best = r.a_lo;
+        std::size_t j_best = r.b_lo;
+        for (std::size_t i = r.a_lo; i + length < r.a_hi; ++i) {
+            for (std::size_t j = r.b_lo; j + length < r.b_hi; ++j) {
+                // blocks are extended from the start of the diagonal only
+                if (a[i] != b[j] || (i != r.a_lo && j != r.b_lo
+                                     && a[i - 1] == b[j - 1])) {
+                    continue;
+                }
+                std::size_t k = 1;
+                while (i + k < r.a_hi && j + k < r.b_hi
+                       && a[i + k] == b[j + k]) {
+                    ++k;
+                }
+                if (k > length) {
+                    i_best = i;
+                    j_best = j;
+                    length = k;
                 }
             }
         }
+        if (length == 0) {
+            continue;
+        }
+        res += length;
+        if (i_best != r.a_lo && j_best != r.b_lo) {
+            ranges.push_back(match_range(r.a_lo, i_best, r.b_lo, j_best));
+        }
+        if (i_best + length != r.a_hi && j_best + length != r.b_hi) {
+            ranges.push_back(match_range(i_best + length, r.a_hi,
+                                         j_best + length, r.b_hi));
+        }
     }
+    return res;
+}
 
-    if (length == 0) {
-        return 0;
-    }
-
-    i = leftReset + length;
-    j = rightReset + length;
-
-    left -= i;
-    right -= j;
-
-    std::size_t leftMatch = (leftReset != 0 && rightReset != 0)
-            ? _match_pattern(a, leftReset, b, rightReset): 0;
-    std::size_t rightMatch = (left != 0 && right != 0)
-            ? _match_pattern(a.substr(i), left, b.substr(j), right) : 0;
-    return length + leftMatch + rightMatch;
+ARGPARSE_INL float
+_gestalt(
+        std::string const& a,
+        std::string const& b,
+        std::vector<match_range>& ranges)
+{
+    std::size_t K = _match_pattern(a.c_str(), a.size(),
+                                   b.c_str(), b.size(), ranges);
+    return static_cast<float>(2 * K) / static_cast<float>(a.size() + b.size());
 }
 
 ARGPARSE_INL float
@@ -9703,8 +11646,117 @@ _gestalt(
         std::string const& a,
         std::string const& b)
 {
-    std::size_t K = _match_pattern(a, a.size(), b, b.size());
-    return static_cast<float>(2 * K) / static_cast<float>(a.size() + b.size());
+    std::vector<match_range> ranges;
+    return _gestalt(a, b, ranges);
+}
+
+// -- CloseMatches ------------------------------------------------------------
+ARGPARSE_INL
+CloseMatches::CloseMatches()
+    : m_possibilities(),
+      m_offsets(),
+      m_postings()
+{ }
+
+ARGPARSE_INL
+CloseMatches::CloseMatches(
+        std::vector<std::string> const& possibilities)
+    : m_possibilities(possibilities),
+      m_offsets(257, 0),
+      m_postings()
+{
+    uint32_t counts[256] = { 0 };
+    for (std::size_t i = 0; i < m_possibilities.size(); ++i) {
+        std::string const& str = m_possibilities.at(i);
+        for (std::size_t j = 0; j < str.size(); ++j) {
+            unsigned char c = static_cast<unsigned char>(str[j]);
+            if (counts[c]++ == 0) {
+                ++m_offsets[c + 1];
+            }
+        }
+        for (std::size_t j = 0; j < str.size(); ++j) {
+            counts[static_cast<unsigned char>(str[j])] = 0;
+        }
+    }
+    for (std::size_t c = 0; c < 256; ++c) {
+        m_offsets[c + 1] += m_offsets[c];
+    }
+    m_postings.resize(m_offsets.back());
+    std::vector<std::size_t> ends(m_offsets.begin(), m_offsets.end() - 1);
+    for (std::size_t i = 0; i < m_possibilities.size(); ++i) {
+        std::string const& str = m_possibilities.at(i);
+        for (std::size_t j = 0; j < str.size(); ++j) {
+            ++counts[static_cast<unsigned char>(str[j])];
+        }
+        for (std::size_t j = 0; j < str.size(); ++j) {
+            unsigned char c = static_cast<unsigned char>(str[j]);
+            if (counts[c] != 0) {
+                m_postings[ends[c]++]
+                        = posting(static_cast<uint32_t>(i), counts[c]);
+                counts[c] = 0;
+            }
+        }
+    }
+}
+
+ARGPARSE_INL bool
+CloseMatches::bound_greater(
+        std::pair<float, std::size_t> const& lhs,
+        std::pair<float, std::size_t> const& rhs)
+{
+    return lhs.first > rhs.first
+            || (lhs.first == rhs.first && lhs.second < rhs.second);
+}
+
+ARGPARSE_INL std::string
+CloseMatches::closest(
+        std::string const& word,
+        float cutoff) const
+{
+    uint32_t counts[256] = { 0 };
+    for (std::size_t i = 0; i < word.size(); ++i) {
+        ++counts[static_cast<unsigned char>(word[i])];
+    }
+    // common bytes of the possibility and the word, the matches upper bound
+    std::vector<std::size_t> common(m_possibilities.size(), 0);
+    for (std::size_t c = 0; c < 256 && !m_postings.empty(); ++c) {
+        if (counts[c] == 0) {
+            continue;
+        }
+        for (std::size_t i = m_offsets[c]; i < m_offsets[c + 1]; ++i) {
+            posting const& p = m_postings[i];
+            common[p.first] += std::min(p.second, counts[c]);
+        }
+    }
+    std::vector<std::pair<float, std::size_t> > shortlist;
+    for (std::size_t i = 0; i < common.size(); ++i) {
+        if (common[i] == 0) {
+            continue;
+        }
+        float bound = static_cast<float>(2 * common[i])
+                / static_cast<float>(m_possibilities[i].size() + word.size());
+        if (bound >= cutoff) {
+            shortlist.push_back(std::make_pair(bound, i));
+        }
+    }
+    std::sort(shortlist.begin(), shortlist.end(), bound_greater);
+    std::vector<match_range> ranges;
+    std::pair<float, std::size_t> best(0.0f, m_possibilities.size());
+    for (std::size_t i = 0; i < shortlist.size(); ++i) {
+        if (shortlist[i].first < best.first) {
+            break;
+        }
+        std::size_t index = shortlist[i].second;
+        float ratio = _gestalt(m_possibilities[index], word, ranges);
+        if (ratio >= cutoff
+                && (ratio > best.first
+                    || (ratio == best.first && index < best.second))) {
+            best.first = ratio;
+            best.second = index;
+        }
+    }
+    return best.second < m_possibilities.size()
+            ? m_possibilities[best.second] : std::string();
 }
 
 ARGPARSE_INL std::string
@@ -9713,28 +11765,21 @@ _get_close_matches(
         std::vector<std::string> const& possibilities,
         float cutoff = 0.6f)
 {
-    std::pair<std::string, float> best;
-    for (std::size_t i = 0; i < possibilities.size(); ++i) {
-        std::string const& str = possibilities.at(i);
-        float ratio = _gestalt(str, word);
-        if (ratio >= cutoff && ratio > best.second) {
-            best.first = str;
-            best.second = ratio;
-        }
-    }
-    return best.first;
+    return CloseMatches(possibilities).closest(word, cutoff);
 }
 
 ARGPARSE_INL std::string
 _suggest_message(
         std::string const& choice,
         std::vector<std::string> const& choices,
-        bool suggest = false)
+        bool suggest = false,
+        CloseMatches const* index = ARGPARSE_NULLPTR)
 {
     if (!suggest || choices.empty() || choice.empty()) {
         return std::string();
     }
-    std::string suggestion = _get_close_matches(choice, choices);
+    std::string suggestion = index ? index->closest(choice)
+                                   : _get_close_matches(choice, choices);
     if (!suggestion.empty()) {
         return ", maybe you meant '" + suggestion + "'?";
     }
@@ -9745,10 +11790,11 @@ ARGPARSE_INL std::string
 _invalid_choice(
         std::string const& choice,
         std::vector<std::string> const& choices,
-        bool suggest = false)
+        bool suggest = false,
+        CloseMatches const* index = ARGPARSE_NULLPTR)
 {
     return ": invalid choice: '" + choice + "'"
-            + _suggest_message(choice, choices, suggest)
+            + _suggest_message(choice, choices, suggest, index)
             + " (choose from " + _join(choices, ", ", "'") + ")";
 }
 
@@ -9894,14 +11940,16 @@ private:
 ARGPARSE_INL
 colorstream::colorstream(
         bool colorize)
-    : m_text(),
+    : m_str(),
+      m_spans(),
       m_colorize(colorize)
 { }
 
 ARGPARSE_INL void
 colorstream::clear()
 {
-    m_text.clear();
+    m_str.clear();
+    m_spans.clear();
 }
 
 ARGPARSE_INL void
@@ -9915,7 +11963,7 @@ ARGPARSE_INL colorstream&
 colorstream::operator <<(
         uint32_t type)
 {
-    m_text.push_back(std::make_pair(type, std::string()));
+    m_spans.push_back(color_span(type, m_str.size()));
     return *this;
 }
 
@@ -9923,11 +11971,10 @@ ARGPARSE_INL colorstream&
 colorstream::operator <<(
         std::string const& str)
 {
-    if (!text().empty()) {
-        m_text.back().second += str;
-    } else {
-        m_text.push_back(std::make_pair(0, str));
+    if (m_spans.empty()) {
+        m_spans.push_back(color_span(0, m_str.size()));
     }
+    m_str += str;
     return *this;
 }
 
@@ -9935,30 +11982,89 @@ ARGPARSE_INL colorstream&
 colorstream::operator <<(
         colorstream const& text)
 {
-    _insert_to_end(text.text(), m_text);
+    append(text, 0, text.words());
+    return *this;
+}
+
+ARGPARSE_INL colorstream&
+colorstream::fill(
+        std::size_t count,
+        char c)
+{
+    if (m_spans.empty()) {
+        m_spans.push_back(color_span(0, m_str.size()));
+    }
+    m_str.append(count, c);
     return *this;
 }
 
+ARGPARSE_INL void
+colorstream::append(
+        colorstream const& text,
+        std::size_t first,
+        std::size_t last)
+{
+    if (first >= last) {
+        return;
+    }
+    std::string::size_type const begin = text.word_begin(first);
+    std::string::size_type const end = text.word_end(last - 1);
+    std::string::size_type const offset = m_str.size();
+    for (std::size_t i = first; i < last; ++i) {
+        m_spans.push_back(color_span(text.m_spans[i].first,
+                                     text.m_spans[i].second - begin + offset));
+    }
+    m_str.append(text.m_str, begin, end - begin);
+}
+
 ARGPARSE_INL void
 colorstream::print(
         std::ostream& os) const
 {
     bool const use_color = colorize();
-    for (std::list<color_word>::const_iterator it = text().begin();
-         it != text().end(); ++it) {
-        if (use_color && (*it).first != 0 && !(*it).second.empty()) {
-            os << code((*it).first) << (*it).second
-               << reset_code();
+    if (!use_color) {
+        os << m_str;
+        return;
+    }
+    for (std::size_t i = 0; i < words(); ++i) {
+        std::string::size_type const begin = word_begin(i);
+        std::string::size_type const end = word_end(i);
+        if (m_spans[i].first != 0 && begin != end) {
+            os << code(m_spans[i].first);
+            os.write(m_str.data() + begin,
+                     static_cast<std::streamsize>(end - begin));
+            os << reset_code();
         } else {
-            os << (*it).second;
+            os.write(m_str.data() + begin,
+                     static_cast<std::streamsize>(end - begin));
         }
     }
 }
 
-ARGPARSE_INL color_text const&
-colorstream::text() const
+ARGPARSE_INL bool
+colorstream::empty() const ARGPARSE_NOEXCEPT
+{
+    return m_spans.empty();
+}
+
+ARGPARSE_INL std::size_t
+colorstream::words() const ARGPARSE_NOEXCEPT
+{
+    return m_spans.size();
+}
+
+ARGPARSE_INL std::string::size_type
+colorstream::word_begin(
+        std::size_t i) const
+{
+    return m_spans.at(i).second;
+}
+
+ARGPARSE_INL std::string::size_type
+colorstream::word_end(
+        std::size_t i) const
 {
-    return m_text;
+    return i + 1 < m_spans.size() ? m_spans[i + 1].second : m_str.size();
 }
 
 ARGPARSE_INL bool
@@ -10013,23 +12119,33 @@ colorstream::reset_code() const
 #endif  // _WIN32
 }
 
-ARGPARSE_INL std::string
-colorstream::str() const
+ARGPARSE_INL std::string const&
+colorstream::str() const ARGPARSE_NOEXCEPT
 {
-    std::string res;
-    for (std::list<color_word>::const_iterator it = text().begin();
-         it != text().end(); ++it) {
-        res += (*it).second;
-    }
-    return res;
+    return m_str;
 }
 
 ARGPARSE_INL std::string
 colorstream::colored() const
 {
-    std::stringstream ss;
-    print(ss);
-    return ss.str();
+    bool const use_color = colorize();
+    if (!use_color) {
+        return m_str;
+    }
+    std::string res;
+    res.reserve(m_str.size() + 12 * words());
+    for (std::size_t i = 0; i < words(); ++i) {
+        std::string::size_type const begin = word_begin(i);
+        std::string::size_type const end = word_end(i);
+        if (m_spans[i].first != 0 && begin != end) {
+            res += code(m_spans[i].first);
+            res.append(m_str, begin, end - begin);
+            res += reset_code();
+        } else {
+            res.append(m_str, begin, end - begin);
+        }
+    }
+    return res;
 }
 
 ARGPARSE_INL bool
@@ -10047,8 +12163,10 @@ ARGPARSE_INL
 StorageData::StorageData()
     : m_exists(),
       m_is_default(),
+      m_is_parsed(),
       m_values(),
-      m_indexes()
+      m_indexes(),
+      m_typed()
 { }
 
 ARGPARSE_INL
@@ -10056,12 +12174,76 @@ StorageData::StorageData(
         std::vector<std::string> const& values)
     : m_exists(true),
       m_is_default(true),
+      m_is_parsed(false),
       m_values(values),
-      m_indexes()
+      m_indexes(),
+      m_typed()
 {
     m_indexes.push_back(m_values.size());
 }
 
+ARGPARSE_INL
+StorageData::StorageData(
+        StorageData const& orig)
+    : m_exists(orig.m_exists),
+      m_is_default(orig.m_is_default),
+      m_is_parsed(orig.m_is_parsed),
+      m_values(orig.m_values),
+      m_indexes(orig.m_indexes),
+      m_typed()
+{
+    if (orig.m_typed) {
+        m_typed.reset(orig.m_typed->clone());
+    }
+}
+
+ARGPARSE_INL StorageData&
+StorageData::operator =(
+        StorageData const& rhs)
+{
+    if (this != &rhs) {
+        this->m_exists      = rhs.m_exists;
+        this->m_is_default  = rhs.m_is_default;
+        this->m_is_parsed   = rhs.m_is_parsed;
+        this->m_values      = rhs.m_values;
+        this->m_indexes     = rhs.m_indexes;
+        this->m_typed.reset();
+        if (rhs.m_typed) {
+            this->m_typed.reset(rhs.m_typed->clone());
+        }
+    }
+    return *this;
+}
+
+#ifdef ARGPARSE_CXX_11
+ARGPARSE_INL
+StorageData::StorageData(
+        StorageData&& orig) ARGPARSE_NOEXCEPT
+    : m_exists(orig.m_exists),
+      m_is_default(orig.m_is_default),
+      m_is_parsed(orig.m_is_parsed),
+      m_values(std::move(orig.m_values)),
+      m_indexes(std::move(orig.m_indexes)),
+      m_typed(std::move(orig.m_typed))
+{
+}
+
+ARGPARSE_INL StorageData&
+StorageData::operator =(
+        StorageData&& rhs) ARGPARSE_NOEXCEPT
+{
+    if (this != &rhs) {
+        this->m_exists      = rhs.m_exists;
+        this->m_is_default  = rhs.m_is_default;
+        this->m_is_parsed   = rhs.m_is_parsed;
+        this->m_values      = std::move(rhs.m_values);
+        this->m_indexes     = std::move(rhs.m_indexes);
+        this->m_typed       = std::move(rhs.m_typed);
+    }
+    return *this;
+}
+#endif  // C++11+
+
 ARGPARSE_INL void
 StorageData::clear()
 {
@@ -10069,6 +12251,20 @@ StorageData::clear()
     m_indexes.clear();
     m_exists = false;
     m_is_default = false;
+    m_is_parsed = false;
+    if (m_typed) {
+        m_typed->clear();
+    }
+}
+
+ARGPARSE_INL void
+StorageData::typed(
+        shared_ptr<TypedValues> const& prototype)
+{
+    m_typed.reset();
+    if (prototype && m_values.empty()) {
+        m_typed.reset(prototype->clone());
+    }
 }
 
 ARGPARSE_INL bool
@@ -10083,6 +12279,19 @@ StorageData::is_default() const ARGPARSE_NOEXCEPT
     return m_is_default;
 }
 
+ARGPARSE_INL void
+StorageData::parsed(
+        bool value) ARGPARSE_NOEXCEPT
+{
+    m_is_parsed = value;
+}
+
+ARGPARSE_INL bool
+StorageData::is_parsed() const ARGPARSE_NOEXCEPT
+{
+    return m_is_parsed;
+}
+
 ARGPARSE_INL std::vector<std::string> const&
 StorageData::operator ()() const ARGPARSE_NOEXCEPT
 {
@@ -10114,7 +12323,7 @@ StorageData::at(
     return m_values.at(i);
 }
 
-ARGPARSE_INL void
+ARGPARSE_INL bool
 StorageData::push_back(
         std::string const& value,
         bool is_default)
@@ -10123,15 +12332,33 @@ StorageData::push_back(
     m_values.push_back(value);
     m_indexes.push_back(m_values.size());
     m_exists = true;
+    return push_typed(value);
 }
 
-ARGPARSE_INL void
+ARGPARSE_INL bool
 StorageData::push_values(
         std::vector<std::string> const& values)
 {
     detail::_insert_to_end(values, m_values);
     m_indexes.push_back(m_values.size());
     m_exists = true;
+    bool res = true;
+    for (std::size_t i = 0; i < values.size() && res; ++i) {
+        res = push_typed(values.at(i));
+    }
+    return res;
+}
+
+ARGPARSE_INL bool
+StorageData::push_typed(
+        std::string const& value)
+{
+    if (m_typed && !m_typed->push_back(value)) {
+        // keep the string values only, conversion is done on demand
+        m_typed.reset();
+        return false;
+    }
+    return true;
 }
 
 ARGPARSE_INL std::vector<std::size_t> const&
@@ -10140,15 +12367,19 @@ StorageData::indexes() const ARGPARSE_NOEXCEPT
     return m_indexes;
 }
 
-ARGPARSE_INL std::vector<std::string>
-StorageData::sub_values(
+ARGPARSE_INL std::vector<std::string>::const_iterator
+StorageData::sub_begin(
+        std::size_t i) const
+{
+    return m_values.begin() + static_cast<dtype>(
+                i == 0 ? 0 : m_indexes.at(i - 1));
+}
+
+ARGPARSE_INL std::vector<std::string>::const_iterator
+StorageData::sub_end(
         std::size_t i) const
 {
-    typedef std::vector<std::string>::difference_type dtype;
-    return std::vector<std::string>(
-                m_values.begin() + static_cast<dtype>(
-                    i == 0 ? 0 : m_indexes.at(i - 1)),
-                m_values.begin() + static_cast<dtype>(m_indexes.at(i)));
+    return m_values.begin() + static_cast<dtype>(m_indexes.at(i));
 }
 }  // namespace detail
 
@@ -10202,17 +12433,27 @@ HelpFormatter::_split_lines(
         std::size_t width) const
 {
     std::string value;
+    // the length of the line is counted by words while it's a valid string
+    std::pair<bool, std::size_t> value_size = std::make_pair(true, 0);
     std::vector<std::string> res;
     std::vector<std::string> split_str = detail::_split(text, "");
     for (std::size_t i = 0; i < split_str.size(); ++i) {
-        if (detail::_utf8_length(value).second + 1
-                + detail::_utf8_length(split_str.at(i)).second > width) {
+        std::string const& word = split_str.at(i);
+        std::size_t const size = value_size.first
+                ? value_size.second : detail::_utf8_length(value).second;
+        std::pair<bool, std::size_t> const word_size
+                = detail::_utf8_length(word);
+        if (size + 1 + word_size.second > width) {
             detail::_store_value_to(value, res);
+            value_size = std::make_pair(true, 0);
         }
-        if (!value.empty() && !split_str.at(i).empty()) {
+        if (!value.empty() && !word.empty()) {
             value += detail::_spaces;
+            ++value_size.second;
         }
-        value += split_str.at(i);
+        value += word;
+        value_size.first = value_size.first && word_size.first;
+        value_size.second += word_size.second;
     }
     detail::_store_value_to(value, res);
     return res;
@@ -10249,7 +12490,7 @@ HelpFormatter::_usage_args(
     }
     for (std::size_t i = 0; i < positional.size(); ++i) {
         if (info.first && info.second == i && !info.first->is_suppress()) {
-            if (!res.text().empty()) {
+            if (!res.empty()) {
                 res << detail::clr_reset << "\n";
             }
             res << detail::clr_summary_short_option << info.first->usage();
@@ -10262,7 +12503,7 @@ HelpFormatter::_usage_args(
     }
     if (info.first && info.second == positional.size()
             && !info.first->is_suppress()) {
-        if (!res.text().empty()) {
+        if (!res.empty()) {
             res << detail::clr_reset << "\n";
         }
         res << detail::clr_summary_short_option << info.first->usage();
@@ -10563,12 +12804,15 @@ Argument::Argument(
       m_implicit(),
       m_type_name(),
       m_choices(),
+      m_choices_set(),
       m_help(),
       m_version(),
       m_metavar(),
       m_dest(detail::_vector(std::string())),
       m_handle(ARGPARSE_NULLPTR),
       m_factory(ARGPARSE_NULLPTR),
+      m_typed(),
+      m_binder(),
       m_post_trigger(),
       m_action(argparse::store),
       m_type(type),
@@ -10605,12 +12849,15 @@ Argument::Argument(
       m_implicit(),
       m_type_name(),
       m_choices(),
+      m_choices_set(),
       m_help(),
       m_version(),
       m_metavar(),
       m_dest(std::vector<std::string>{ std::string() }),
       m_handle(nullptr),
       m_factory(nullptr),
+      m_typed(),
+      m_binder(),
       m_post_trigger(),
       m_action(argparse::store),
       m_type(type),
@@ -10645,12 +12892,15 @@ Argument::Argument(
       m_implicit(),
       m_type_name(),
       m_choices(),
+      m_choices_set(),
       m_help(),
       m_version(),
       m_metavar(),
       m_dest(detail::_vector(std::string())),
       m_handle(ARGPARSE_NULLPTR),
       m_factory(ARGPARSE_NULLPTR),
+      m_typed(),
+      m_binder(),
       m_post_trigger(),
       m_action(argparse::store),
       m_type(NoType),
@@ -10675,12 +12925,15 @@ Argument::Argument(
       m_implicit(),
       m_type_name(),
       m_choices(),
+      m_choices_set(),
       m_help(),
       m_version(),
       m_metavar(),
       m_dest(detail::_vector(std::string())),
       m_handle(ARGPARSE_NULLPTR),
       m_factory(ARGPARSE_NULLPTR),
+      m_typed(),
+      m_binder(),
       m_post_trigger(),
       m_action(argparse::store),
       m_type(NoType),
@@ -10706,12 +12959,15 @@ Argument::Argument(
       m_implicit(),
       m_type_name(),
       m_choices(),
+      m_choices_set(),
       m_help(),
       m_version(),
       m_metavar(),
       m_dest(detail::_vector(std::string())),
       m_handle(ARGPARSE_NULLPTR),
       m_factory(ARGPARSE_NULLPTR),
+      m_typed(),
+      m_binder(),
       m_post_trigger(),
       m_action(argparse::store),
       m_type(NoType),
@@ -10738,12 +12994,15 @@ Argument::Argument(
       m_implicit(),
       m_type_name(),
       m_choices(),
+      m_choices_set(),
       m_help(),
       m_version(),
       m_metavar(),
       m_dest(detail::_vector(std::string())),
       m_handle(ARGPARSE_NULLPTR),
       m_factory(ARGPARSE_NULLPTR),
+      m_typed(),
+      m_binder(),
       m_post_trigger(),
       m_action(argparse::store),
       m_type(NoType),
@@ -10768,12 +13027,15 @@ Argument::Argument(
       m_implicit(),
       m_type_name(),
       m_choices(),
+      m_choices_set(),
       m_help(),
       m_version(),
       m_metavar(),
       m_dest(detail::_vector(std::string())),
       m_handle(ARGPARSE_NULLPTR),
       m_factory(ARGPARSE_NULLPTR),
+      m_typed(),
+      m_binder(),
       m_post_trigger(),
       m_action(argparse::store),
       m_type(NoType),
@@ -10797,12 +13059,15 @@ Argument::Argument(
       m_implicit(orig.m_implicit),
       m_type_name(orig.m_type_name),
       m_choices(orig.m_choices),
+      m_choices_set(orig.m_choices_set),
       m_help(orig.m_help),
       m_version(orig.m_version),
       m_metavar(orig.m_metavar),
       m_dest(orig.m_dest),
       m_handle(orig.m_handle),
       m_factory(orig.m_factory),
+      m_typed(orig.m_typed),
+      m_binder(orig.m_binder),
       m_post_trigger(orig.m_post_trigger),
       m_action(orig.m_action),
       m_type(orig.m_type),
@@ -10827,12 +13092,15 @@ Argument::operator =(
         this->m_implicit    = rhs.m_implicit;
         this->m_type_name   = rhs.m_type_name;
         this->m_choices     = rhs.m_choices;
+        this->m_choices_set = rhs.m_choices_set;
         this->m_help        = rhs.m_help;
         this->m_version     = rhs.m_version;
         this->m_metavar     = rhs.m_metavar;
         this->m_dest        = rhs.m_dest;
         this->m_handle      = rhs.m_handle;
         this->m_factory     = rhs.m_factory;
+        this->m_typed       = rhs.m_typed;
+        this->m_binder      = rhs.m_binder;
         this->m_post_trigger= rhs.m_post_trigger;
         this->m_action      = rhs.m_action;
         this->m_type        = rhs.m_type;
@@ -10857,12 +13125,15 @@ Argument::Argument(
       m_implicit(std::move(orig.m_implicit)),
       m_type_name(std::move(orig.m_type_name)),
       m_choices(std::move(orig.m_choices)),
+      m_choices_set(std::move(orig.m_choices_set)),
       m_help(std::move(orig.m_help)),
       m_version(std::move(orig.m_version)),
       m_metavar(std::move(orig.m_metavar)),
       m_dest(std::move(orig.m_dest)),
       m_handle(std::move(orig.m_handle)),
       m_factory(std::move(orig.m_factory)),
+      m_typed(std::move(orig.m_typed)),
+      m_binder(std::move(orig.m_binder)),
       m_post_trigger(std::move(orig.m_post_trigger)),
       m_action(std::move(orig.m_action)),
       m_type(std::move(orig.m_type)),
@@ -10887,12 +13158,15 @@ Argument::operator =(
         this->m_implicit    = std::move(rhs.m_implicit);
         this->m_type_name   = std::move(rhs.m_type_name);
         this->m_choices     = std::move(rhs.m_choices);
+        this->m_choices_set = std::move(rhs.m_choices_set);
         this->m_help        = std::move(rhs.m_help);
         this->m_version     = std::move(rhs.m_version);
         this->m_metavar     = std::move(rhs.m_metavar);
         this->m_dest        = std::move(rhs.m_dest);
         this->m_handle      = std::move(rhs.m_handle);
         this->m_factory     = std::move(rhs.m_factory);
+        this->m_typed       = std::move(rhs.m_typed);
+        this->m_binder      = std::move(rhs.m_binder);
         this->m_post_trigger= std::move(rhs.m_post_trigger);
         this->m_action      = std::move(rhs.m_action);
         this->m_type        = std::move(rhs.m_type);
@@ -10956,6 +13230,7 @@ Argument::action(
             m_nargs_str = std::string("0");
             m_num_args = 0;
             m_choices.reset();
+            m_choices_set.reset();
             break;
         case argparse::store_false :
             if (!m_default.has_value()) {
@@ -10969,6 +13244,7 @@ Argument::action(
             m_nargs_str = std::string("0");
             m_num_args = 0;
             m_choices.reset();
+            m_choices_set.reset();
             break;
         case argparse::version :
         case argparse::help :
@@ -10983,6 +13259,7 @@ Argument::action(
             m_nargs_str = std::string("0");
             m_num_args = 0;
             m_choices.reset();
+            m_choices_set.reset();
             break;
         case argparse::store :
         case argparse::append :
@@ -11152,6 +13429,7 @@ Argument::type(
         std::string const& value)
 {
     m_type_name.reset(value);
+    m_typed.reset();
     return *this;
 }
 
@@ -11173,6 +13451,7 @@ Argument::choice(
     std::vector<std::string> values;
     values.push_back(value);
     m_choices = ARGPARSE_MOVE(values);
+    m_choices_set = detail::_choices_set(m_choices.value());
     return *this;
 }
 
@@ -11189,6 +13468,7 @@ Argument::choices(
         values.push_back(std::string(1, value.at(i)));
     }
     m_choices = ARGPARSE_MOVE(values);
+    m_choices_set = detail::_choices_set(m_choices.value());
     return *this;
 }
 
@@ -11236,6 +13516,7 @@ Argument::choices(
         throw TypeError("got an unexpected keyword argument 'choices'");
     }
     m_choices = value;
+    m_choices_set = detail::_choices_set(m_choices.value());
     return *this;
 }
 
@@ -11345,6 +13626,7 @@ Argument::dest(
         throw ValueError("dest supplied twice for positional argument");
     }
     m_dest.front() = value;
+    detail::_names_changed();
     return *this;
 }
 
@@ -11487,6 +13769,7 @@ Argument::prepare_action(
     } else {
         m_all_flags = m_flags;
     }
+    detail::_names_changed();
 }
 
 ARGPARSE_INL void
@@ -11646,8 +13929,8 @@ Argument::get_help(
     std::string res = help;
     std::string text;
 #ifdef ARGPARSE_CXX_11
-    std::regex const r("%[(]([a-z_]*)[)]s");
-    std::smatch match;
+    std::string::size_type pos = 0;
+    std::pair<std::string::size_type, std::string::size_type> match;
     std::unordered_map<std::string, std::function<std::string()> > const
             specifiers =
     {
@@ -11664,13 +13947,16 @@ Argument::get_help(
         { "%(required)s",       [this]() { return get_required();   } },
         { "%(type)s",           [this]() { return get_type();       } },
     };
-    while (std::regex_search(res, match, r)) {
-        text += match.prefix();
-        auto specifier = std::string(match[0]);
+    while ((match = detail::_find_specifier(res, pos)).first
+           != std::string::npos) {
+        text.append(res, pos, match.first - pos);
+        auto specifier
+                = res.substr(match.first, match.second - match.first);
         auto it = specifiers.find(specifier);
         text += (it != specifiers.end() ? it->second() : std::move(specifier));
-        res = match.suffix();
+        pos = match.second;
     }
+    res.erase(0, pos);
 #else
     std::string const beg = "%(";
     std::string const end = ")s";
@@ -11789,11 +14075,12 @@ Argument::resolve_conflict_flags(
 {
     detail::_resolve_conflict(flags, m_flags);
     detail::_resolve_conflict(flags, m_all_flags);
+    detail::_names_changed();
 }
 
 ARGPARSE_INL void
 Argument::push_value(
-        std::string const& value,
+        detail::token const& value,
         std::vector<std::string>& values) const
 {
     if (action() == argparse::extend && m_nargs == detail::ZERO_OR_ONE) {
@@ -11801,7 +14088,7 @@ Argument::push_value(
             values.push_back(std::string(1, value.at(i)));
         }
     } else if (!value.empty() || m_num_args <= 1) {
-        values.push_back(value);
+        values.push_back(detail::_token_str(value));
     }
 }
 
@@ -11839,6 +14126,14 @@ Argument::error_nargs(
 ARGPARSE_INL bool
 Argument::is_match_name(
         std::string const& value) const
+{
+    return is_match_name(value, m_flags);
+}
+
+ARGPARSE_INL bool
+Argument::is_match_name(
+        std::string const& value,
+        std::vector<std::string> const& flags) const
 {
     if (!dest().empty()) {
         return dest() == value;
@@ -11847,16 +14142,16 @@ Argument::is_match_name(
         case Positional :
             return m_name == value;
         case Operand :
-            for (std::size_t j = 0; j < m_flags.size(); ++j) {
-                if (m_flags.at(j) == value || (m_flags.at(j) + "=" == value)) {
+            for (std::size_t j = 0; j < flags.size(); ++j) {
+                if (flags.at(j) == value || (flags.at(j) + "=" == value)) {
                     return true;
                 }
             }
             return false;
         case Optional :
-            for (std::size_t j = 0; j < m_flags.size(); ++j) {
-                if (m_flags.at(j) == value || m_name == value
-                        || detail::_flag_name(m_flags.at(j)) == value) {
+            for (std::size_t j = 0; j < flags.size(); ++j) {
+                if (flags.at(j) == value || m_name == value
+                        || detail::_flag_name(flags.at(j)) == value) {
                     return true;
                 }
             }
@@ -12043,6 +14338,7 @@ _ArgumentData::check_conflicting_option(
 {
     if (m_conflict_handler == detail::_conflict_resolve) {
         detail::_resolve_conflict(arg->flags(), flags);
+        detail::_names_changed();
     } else {
         std::vector<std::string> conflict_options;
         for (std::size_t i = 0; i < arg->flags().size(); ++i) {
@@ -12608,10 +14904,134 @@ ArgumentGroup::print_help(
     }
 }
 
+// -- ArgumentKey -------------------------------------------------------------
+ARGPARSE_INL
+ArgumentKey::ArgumentKey()
+    : m_argument(ARGPARSE_NULLPTR),
+      m_slot(),
+      m_name()
+{ }
+
+ARGPARSE_INL
+ArgumentKey::ArgumentKey(
+        Argument const* argument,
+        std::size_t slot,
+        std::string const& name)
+    : m_argument(argument),
+      m_slot(slot),
+      m_name(name)
+{ }
+
+ARGPARSE_INL
+ArgumentKey::ArgumentKey(
+        ArgumentKey const& orig)
+    : m_argument(orig.m_argument),
+      m_slot(orig.m_slot),
+      m_name(orig.m_name)
+{ }
+
+ARGPARSE_INL ArgumentKey&
+ArgumentKey::operator =(
+        ArgumentKey const& rhs)
+{
+    if (this != &rhs) {
+        this->m_argument    = rhs.m_argument;
+        this->m_slot        = rhs.m_slot;
+        this->m_name        = rhs.m_name;
+    }
+    return *this;
+}
+
+ARGPARSE_INL std::string const&
+ArgumentKey::name() const ARGPARSE_NOEXCEPT
+{
+    return m_name;
+}
+
+// -- ParsedArgument ----------------------------------------------------------
+ARGPARSE_INL
+ParsedArgument::ParsedArgument(
+        detail::storage_value const* data,
+        std::size_t slot)
+    : m_data(data),
+      m_slot(slot)
+{ }
+
+ARGPARSE_INL
+ParsedArgument::ParsedArgument(
+        ParsedArgument const& orig)
+    : m_data(orig.m_data),
+      m_slot(orig.m_slot)
+{ }
+
+ARGPARSE_INL ParsedArgument&
+ParsedArgument::operator =(
+        ParsedArgument const& rhs)
+{
+    if (this != &rhs) {
+        this->m_data    = rhs.m_data;
+        this->m_slot    = rhs.m_slot;
+    }
+    return *this;
+}
+
+ARGPARSE_INL std::string const&
+ParsedArgument::dest() const ARGPARSE_NOEXCEPT
+{
+    return m_data->first->get_dest();
+}
+
+ARGPARSE_INL Argument const&
+ParsedArgument::argument() const ARGPARSE_NOEXCEPT
+{
+    return *(m_data->first);
+}
+
+ARGPARSE_INL ArgumentKey
+ParsedArgument::key() const
+{
+    return ArgumentKey(m_data->first.get(), m_slot, dest());
+}
+
+ARGPARSE_INL std::vector<std::string> const&
+ParsedArgument::values() const ARGPARSE_NOEXCEPT
+{
+    return m_data->second();
+}
+
+ARGPARSE_INL bool
+ParsedArgument::is_default() const ARGPARSE_NOEXCEPT
+{
+    return m_data->second.is_default();
+}
+
+ARGPARSE_INL ParsedArgument::Source
+ParsedArgument::source() const ARGPARSE_NOEXCEPT
+{
+    if (m_data->second.is_parsed()) {
+        return CommandLine;
+    }
+    return m_data->second.exists() ? Default : NotSet;
+}
+
 // -- _Storage ----------------------------------------------------------------
 ARGPARSE_INL
 _Storage::_Storage()
-    : m_data()
+    : m_data(),
+      m_slots(),
+      m_flags(),
+      m_dests(),
+      m_names(),
+      m_match_names(),
+      m_hidden_flags(),
+      m_saved(),
+      m_saved_data(),
+      m_saved_hidden(),
+      m_saved_size(std::string::npos),
+      m_saved_all(false),
+      m_names_version(detail::_names_version()),
+      m_slots_valid(true),
+      m_names_valid(true)
 { }
 
 ARGPARSE_INL void
@@ -12622,16 +15042,38 @@ _Storage::create(
     if (key->action() & (argparse::version | argparse::help)) {
         return;
     }
-    bool has_key = false;
-    for (const_iterator it = m_data.begin(); it != m_data.end(); ++it) {
-        has_key = has_key || (key == (*it).first);
-        if (key != (*it).first) {
-            (*it).first->resolve_conflict_flags(key->flags());
+    update_slots();
+    // the later arguments (of the subparsers) hide the conflicting flags
+    // in this storage only, the arguments are shared between the parses
+    std::vector<std::string> const& flags = key->flags();
+    for (std::size_t i = 0; i < flags.size(); ++i) {
+        flag_map::const_iterator it = m_flags.find(flags.at(i));
+        if (it == m_flags.end()) {
+            continue;
+        }
+        for (std::size_t j = 0; j < it->second.size(); ++j) {
+            Argument const* arg = m_data.at(it->second.at(j)).first.get();
+            if (key.get() == arg) {
+                continue;
+            }
+            hide_map::iterator hidden = m_hidden_flags.find(arg);
+            if (hidden == m_hidden_flags.end()) {
+                hidden = m_hidden_flags.insert(
+                            std::make_pair(arg, arg->m_flags)).first;
+            }
+            detail::_resolve_conflict(flags, hidden->second);
         }
     }
-    if (!has_key) {
+    if (m_slots.find(key.get()) == m_slots.end()) {
         m_data.push_back(std::make_pair(key, value));
+        if (key->m_typed && !key->m_factory
+                && (key->action() & detail::_store_action)
+                && key->m_type_name.value() == key->m_typed->type_name()) {
+            m_data.back().second.typed(key->m_typed);
+        }
+        add_slot(m_data.size() - 1);
     }
+    m_names_valid = false;
 }
 
 ARGPARSE_INL void
@@ -12651,36 +15093,48 @@ ARGPARSE_INL void
 _Storage::have_value(
         key_type const& key)
 {
+    mapped_type& arg_data = at(key);
+    arg_data.parsed(true);
     if (key->implicit_value().empty()) {
-        at(key).push_values(std::vector<std::string>());
+        arg_data.push_values(std::vector<std::string>());
         on_process_store(key, std::vector<std::string>());
     } else {
-        at(key).push_back(key->implicit_value());
+        arg_data.push_back(key->implicit_value());
         on_process_store(key, key->implicit_value());
         key->handle(key->implicit_value());
     }
 }
 
-ARGPARSE_INL void
+ARGPARSE_INL bool
 _Storage::store_value(
         key_type const& key,
         std::string const& value)
 {
-    at(key).push_back(value);
+    mapped_type& arg_data = at(key);
+    arg_data.parsed(true);
+    if (!arg_data.push_back(value)) {
+        return false;
+    }
     on_process_store(key, value);
     key->handle(value);
+    return true;
 }
 
-ARGPARSE_INL void
+ARGPARSE_INL bool
 _Storage::store_values(
         key_type const& key,
         std::vector<std::string> const& values)
 {
-    at(key).push_values(values);
+    mapped_type& arg_data = at(key);
+    arg_data.parsed(true);
+    if (!arg_data.push_values(values)) {
+        return false;
+    }
     on_process_store(key, values);
     for (std::size_t i = 0; i < values.size(); ++i) {
         key->handle(values.at(i));
     }
+    return true;
 }
 
 ARGPARSE_INL void
@@ -12706,17 +15160,22 @@ _Storage::self_value_stored(
     if (key->action() & (argparse::store_const | detail::_bool_action)) {
         mapped_type& arg_data = at(key);
         arg_data.clear();
+        arg_data.parsed(true);
         arg_data.push_back(key->const_value());
         on_process_store(key, key->const_value());
         key->handle(key->const_value());
         return true;
     } else if (key->action() == argparse::append_const) {
-        at(key).push_back(key->const_value());
+        mapped_type& arg_data = at(key);
+        arg_data.parsed(true);
+        arg_data.push_back(key->const_value());
         on_process_store(key, key->const_value());
         key->handle(key->const_value());
         return true;
     } else if (key->action() == argparse::count) {
-        at(key).push_back(std::string());
+        mapped_type& arg_data = at(key);
+        arg_data.parsed(true);
+        arg_data.push_back(std::string());
         on_process_store(key, std::string());
         key->handle(std::string());
         return true;
@@ -12764,138 +15223,394 @@ _Storage::at(
     if (it == end()) {
         throw std::out_of_range("key '" + key->m_name + "' not found");
     }
-    return it->second;
+    return it->second;
+}
+
+ARGPARSE_INL _Storage::mapped_type const&
+_Storage::at(
+        key_type const& key) const
+{
+    const_iterator it = find(key);
+    if (it == end()) {
+        throw std::out_of_range("key '" + key->m_name + "' not found");
+    }
+    return it->second;
+}
+
+ARGPARSE_INL _Storage::iterator
+_Storage::erase(
+        iterator it)
+{
+    if (static_cast<std::size_t>(it - m_data.begin()) < m_saved_size) {
+        save_all();
+    }
+    m_slots_valid = false;
+    m_names_valid = false;
+    m_hidden_flags.erase(it->first.get());
+    return m_data.erase(it);
+}
+
+ARGPARSE_INL _Storage::iterator
+_Storage::begin()
+{
+    // the values can be changed by the iterators
+    save_all();
+    return m_data.begin();
+}
+
+ARGPARSE_INL _Storage::iterator
+_Storage::end() ARGPARSE_NOEXCEPT
+{
+    return m_data.end();
+}
+
+ARGPARSE_INL _Storage::const_iterator
+_Storage::begin() const ARGPARSE_NOEXCEPT
+{
+    return m_data.begin();
+}
+
+ARGPARSE_INL _Storage::const_iterator
+_Storage::end() const ARGPARSE_NOEXCEPT
+{
+    return m_data.end();
+}
+
+ARGPARSE_INL bool
+_Storage::empty() const ARGPARSE_NOEXCEPT
+{
+    return m_data.empty();
+}
+
+ARGPARSE_INL _Storage::const_iterator
+_Storage::find_arg(
+        std::string const& key) const
+{
+    const_iterator it = find(key);
+    if (it != end()) {
+        return it;
+    }
+    if (names_indexed()) {
+        name_map::const_iterator name = m_match_names.find(key);
+        return name != m_match_names.end() ? slot_at(name->second) : end();
+    }
+    // arguments were renamed after indexing, the lookup must not write
+    for (it = begin(); it != end(); ++it) {
+        if (it->first->is_match_name(key, visible_flags(*(it->first)))) {
+            break;
+        }
+    }
+    return it;
+}
+
+ARGPARSE_INL _Storage::const_iterator
+_Storage::find(
+        ArgumentKey const& key) const
+{
+    if (key.m_slot < m_data.size()
+            && m_data[key.m_slot].first.get() == key.m_argument) {
+        return slot_at(key.m_slot);
+    }
+    if (key.m_argument) {
+        const_iterator it = find_slot(key.m_argument);
+        if (it != end()) {
+            return it;
+        }
+    }
+    return find_arg(key.m_name);
+}
+
+ARGPARSE_INL _Storage::const_iterator
+_Storage::find(
+        std::string const& key) const
+{
+    if (names_indexed()) {
+        name_map::const_iterator name = m_names.find(key);
+        return name != m_names.end() ? slot_at(name->second) : end();
+    }
+    const_iterator it = begin();
+    for ( ; it != end() && !is_name(*(it->first), key); ++it) {
+    }
+    return it;
+}
+
+ARGPARSE_INL _Storage::const_iterator
+_Storage::find(
+        key_type const& key) const
+{
+    return find_slot(key.get());
+}
+
+ARGPARSE_INL _Storage::iterator
+_Storage::find(
+        key_type const& key)
+{
+    update_slots();
+    slot_map::const_iterator it = m_slots.find(key.get());
+    if (it == m_slots.end()) {
+        return end();
+    }
+    save_slot(it->second);
+    return m_data.begin() + static_cast<dtype>(it->second);
+}
+
+ARGPARSE_INL void
+_Storage::on_process_store(
+        key_type const& key,
+        std::string const& value)
+{
+    std::vector<std::size_t> const& group = dest_group(key);
+    for (std::size_t i = 0; i < group.size(); ++i) {
+        iterator it = m_data.begin() + static_cast<dtype>(group.at(i));
+        if (it->first != key) {
+            save_slot(group.at(i));
+            if (it->first->action() & (argparse::store
+                                       | argparse::store_const
+                                       | detail::_bool_action
+                                       | argparse::BooleanOptionalAction)) {
+                it->second.clear();
+            }
+            it->second.push_back(value);
+            it->second.parsed(at(key).is_parsed());
+        }
+    }
+}
+
+ARGPARSE_INL void
+_Storage::on_process_store(
+        key_type const& key,
+        std::vector<std::string> const& values)
+{
+    std::vector<std::size_t> const& group = dest_group(key);
+    for (std::size_t i = 0; i < group.size(); ++i) {
+        iterator it = m_data.begin() + static_cast<dtype>(group.at(i));
+        if (it->first != key) {
+            save_slot(group.at(i));
+            if (it->first->action() & (argparse::store
+                                       | argparse::store_const
+                                       | detail::_bool_action
+                                       | argparse::BooleanOptionalAction)) {
+                it->second.clear();
+            }
+            it->second.push_values(values);
+            it->second.parsed(at(key).is_parsed());
+        }
+    }
 }
 
-ARGPARSE_INL _Storage::mapped_type const&
-_Storage::at(
-        key_type const& key) const
+ARGPARSE_INL std::vector<std::size_t> const&
+_Storage::dest_group(
+        key_type const& key)
 {
-    const_iterator it = find(key);
-    if (it == end()) {
-        throw std::out_of_range("key '" + key->m_name + "' not found");
+    static std::vector<std::size_t> const empty;
+    if (key->dest().empty()) {
+        return empty;
     }
-    return it->second;
+    update_slots();
+    flag_map::const_iterator it = m_dests.find(key->dest());
+    // arguments without dest aliases have a single slot group
+    return it != m_dests.end() && it->second.size() > 1 ? it->second : empty;
 }
 
-ARGPARSE_INL _Storage::iterator
-_Storage::erase(
-        iterator it)
+ARGPARSE_INL void
+_Storage::update_slots()
 {
-    return m_data.erase(it);
+    if (m_slots_valid) {
+        return;
+    }
+    m_slots.clear();
+    m_flags.clear();
+    m_dests.clear();
+    for (std::size_t i = 0; i < m_data.size(); ++i) {
+        add_slot(i);
+    }
+    m_slots_valid = true;
 }
 
-ARGPARSE_INL _Storage::iterator
-_Storage::begin() ARGPARSE_NOEXCEPT
+ARGPARSE_INL void
+_Storage::update_names()
 {
-    return m_data.begin();
+    if (names_indexed()) {
+        return;
+    }
+    m_names_version = detail::_names_version();
+    m_names.clear();
+    m_match_names.clear();
+    // keep the first argument with the name, as the linear search did
+    for (std::size_t i = 0; i < m_data.size(); ++i) {
+        Argument const& arg = *(m_data.at(i).first);
+        if (!arg.dest().empty()) {
+            m_names.insert(std::make_pair(arg.dest(), i));
+            m_match_names.insert(std::make_pair(arg.dest(), i));
+            continue;
+        }
+        std::vector<std::string> const& flags = visible_flags(arg);
+        for (std::size_t j = 0; j < flags.size(); ++j) {
+            std::string const& flag = flags.at(j);
+            m_names.insert(std::make_pair(flag, i));
+            m_match_names.insert(std::make_pair(flag, i));
+            if (arg.m_type == Argument::Operand) {
+                m_match_names.insert(std::make_pair(flag + detail::_equals, i));
+            } else if (arg.m_type == Argument::Optional) {
+                m_match_names.insert(std::make_pair(arg.m_name, i));
+                m_match_names.insert(
+                            std::make_pair(detail::_flag_name(flag), i));
+            }
+        }
+        if (arg.m_type == Argument::Positional) {
+            m_match_names.insert(std::make_pair(arg.m_name, i));
+        }
+    }
+    m_names_valid = true;
 }
 
-ARGPARSE_INL _Storage::iterator
-_Storage::end() ARGPARSE_NOEXCEPT
+ARGPARSE_INL bool
+_Storage::names_indexed() const
 {
-    return m_data.end();
+    return m_names_valid && m_names_version == detail::_names_version();
 }
 
-ARGPARSE_INL _Storage::const_iterator
-_Storage::begin() const ARGPARSE_NOEXCEPT
+ARGPARSE_INL void
+_Storage::add_slot(
+        std::size_t slot)
 {
-    return m_data.begin();
+    Argument const& arg = *(m_data.at(slot).first);
+    m_slots.insert(std::make_pair(&arg, slot));
+    if (!arg.dest().empty()) {
+        m_dests[arg.dest()].push_back(slot);
+    }
+    for (std::size_t i = 0; i < arg.m_all_flags.size(); ++i) {
+        m_flags[arg.m_all_flags.at(i)].push_back(slot);
+    }
+    for (std::size_t i = 0; i < arg.m_flags.size(); ++i) {
+        if (!detail::_exists(arg.m_flags.at(i), arg.m_all_flags)) {
+            m_flags[arg.m_flags.at(i)].push_back(slot);
+        }
+    }
 }
 
 ARGPARSE_INL _Storage::const_iterator
-_Storage::end() const ARGPARSE_NOEXCEPT
+_Storage::slot_at(
+        std::size_t slot) const
 {
-    return m_data.end();
+    return m_data.begin() + static_cast<dtype>(slot);
 }
 
 ARGPARSE_INL _Storage::const_iterator
-_Storage::find_arg(
-        std::string const& key) const
+_Storage::find_slot(
+        Argument const* key) const
 {
-    const_iterator it = find(key);
-    if (it != end()) {
-        return it;
+    if (m_slots_valid) {
+        slot_map::const_iterator it = m_slots.find(key);
+        return it != m_slots.end() ? slot_at(it->second) : end();
     }
-    for (it = begin(); it != end() && !it->first->is_match_name(key); ++it) {
+    const_iterator it = begin();
+    for ( ; it != end() && it->first.get() != key; ++it) {
     }
     return it;
 }
 
-ARGPARSE_INL _Storage::const_iterator
-_Storage::find(
+ARGPARSE_INL std::vector<std::string> const&
+_Storage::argument_flags(
+        Argument const& arg) const
+{
+    return arg.dest().empty() ? visible_flags(arg) : arg.m_dest;
+}
+
+ARGPARSE_INL std::vector<std::string> const&
+_Storage::visible_flags(
+        Argument const& arg) const
+{
+    hide_map::const_iterator it = m_hidden_flags.find(&arg);
+    return it != m_hidden_flags.end() ? it->second : arg.m_flags;
+}
+
+ARGPARSE_INL bool
+_Storage::is_name(
+        Argument const& arg,
         std::string const& key) const
 {
-    const_iterator it = begin();
-    for ( ; it != end() && !(*(it->first) == key); ++it) {
-    }
-    return it;
+    return !arg.dest().empty() ? arg.dest() == key
+                               : detail::_exists(key, visible_flags(arg));
 }
 
-ARGPARSE_INL _Storage::const_iterator
-_Storage::find(
-        key_type const& key) const
+ARGPARSE_INL void
+_Storage::begin_update()
 {
-    const_iterator it = begin();
-    for ( ; it != end() && it->first != key; ++it) {
-    }
-    return it;
+    m_saved.clear();
+    m_saved_data.clear();
+    m_saved_hidden = m_hidden_flags;
+    m_saved_size = m_data.size();
+    m_saved_all = false;
 }
 
-ARGPARSE_INL _Storage::iterator
-_Storage::find(
-        key_type const& key)
+ARGPARSE_INL void
+_Storage::commit_update()
 {
-    iterator it = begin();
-    for ( ; it != end() && it->first != key; ++it) {
-    }
-    return it;
+    m_saved.clear();
+    m_saved_data.clear();
+    m_saved_hidden.clear();
+    m_saved_size = std::string::npos;
+    m_saved_all = false;
 }
 
 ARGPARSE_INL void
-_Storage::on_process_store(
-        key_type const& key,
-        std::string const& value)
+_Storage::rollback_update()
 {
-    if (!key->dest().empty()) {
-        for (iterator it = begin(); it != end(); ++it) {
-            if (it->first != key && it->first->dest() == key->dest()) {
-                if (it->first->action() & (argparse::store
-                                           | argparse::store_const
-                                           | detail::_bool_action
-                                           | argparse::BooleanOptionalAction)) {
-                    it->second.clear();
-                }
-                it->second.push_back(value);
-            }
+    if (m_saved_size == std::string::npos) {
+        return;
+    }
+    if (m_saved_all) {
+        m_data.swap(m_saved_data);
+    } else {
+        typedef detail::hash_map<std::size_t, mapped_type>::type saved_map;
+        for (saved_map::iterator it = m_saved.begin();
+             it != m_saved.end(); ++it) {
+            m_data.at(it->first).second = ARGPARSE_MOVE(it->second);
         }
+        // the created arguments are at the end
+        m_data.erase(m_data.begin() + static_cast<dtype>(m_saved_size),
+                     m_data.end());
     }
+    m_hidden_flags.swap(m_saved_hidden);
+    commit_update();
+    m_slots_valid = false;
+    m_names_valid = false;
+    update_slots();
+    update_names();
 }
 
 ARGPARSE_INL void
-_Storage::on_process_store(
-        key_type const& key,
-        std::vector<std::string> const& values)
+_Storage::save_slot(
+        std::size_t slot)
 {
-    if (!key->dest().empty()) {
-        for (iterator it = begin(); it != end(); ++it) {
-            if (it->first != key && it->first->dest() == key->dest()) {
-                if (it->first->action() & (argparse::store
-                                           | argparse::store_const
-                                           | detail::_bool_action
-                                           | argparse::BooleanOptionalAction)) {
-                    it->second.clear();
-                }
-                it->second.push_values(values);
-            }
-        }
+    if (m_saved_all || slot >= m_saved_size
+            || m_saved.find(slot) != m_saved.end()) {
+        return;
     }
+    m_saved.insert(std::make_pair(slot, m_data.at(slot).second));
+}
+
+ARGPARSE_INL void
+_Storage::save_all()
+{
+    if (m_saved_all || m_saved_size == std::string::npos) {
+        return;
+    }
+    m_saved_data.assign(m_data.begin(),
+                        m_data.begin() + static_cast<dtype>(m_saved_size));
+    typedef detail::hash_map<std::size_t, mapped_type>::type saved_map;
+    for (saved_map::iterator it = m_saved.begin(); it != m_saved.end(); ++it) {
+        m_saved_data.at(it->first).second = ARGPARSE_MOVE(it->second);
+    }
+    m_saved.clear();
+    m_saved_all = true;
 }
 
 // -- Namespace ---------------------------------------------------------------
 ARGPARSE_INL
 Namespace::Namespace(
-        _Storage const& storage,
+        detail::CowValue<_Storage> const& storage,
         detail::func1<Namespace const&>::type const& func)
     : m_storage(storage),
       m_func(func),
@@ -12905,7 +15620,7 @@ Namespace::Namespace(
 
 ARGPARSE_INL
 Namespace::Namespace(
-        _Storage const& storage,
+        detail::CowValue<_Storage> const& storage,
         detail::func1<Namespace const&>::type const& func,
         std::vector<std::string> const& args)
     : m_storage(storage),
@@ -12917,7 +15632,7 @@ Namespace::Namespace(
 #ifdef ARGPARSE_CXX_11
 ARGPARSE_INL
 Namespace::Namespace(
-        _Storage&& storage,
+        detail::CowValue<_Storage>&& storage,
         detail::func1<Namespace const&>::type&& func) ARGPARSE_NOEXCEPT
     : m_storage(std::move(storage)),
       m_func(std::move(func)),
@@ -12927,7 +15642,7 @@ Namespace::Namespace(
 
 ARGPARSE_INL
 Namespace::Namespace(
-        _Storage&& storage,
+        detail::CowValue<_Storage>&& storage,
         detail::func1<Namespace const&>::type&& func,
         std::vector<std::string>&& args) ARGPARSE_NOEXCEPT
     : m_storage(std::move(storage)),
@@ -12953,6 +15668,22 @@ Namespace::exists(
     return contains(key);
 }
 
+ARGPARSE_INL bool
+Namespace::contains(
+        ArgumentKey const& key) const
+{
+    _Storage::value_type const* args = find_data(key);
+    return args && (!args->second.empty()
+                    || args->first->action() == argparse::count);
+}
+
+ARGPARSE_INL bool
+Namespace::exists(
+        ArgumentKey const& key) const
+{
+    return contains(key);
+}
+
 ARGPARSE_INL void
 Namespace::func(
         Namespace const& args) const
@@ -12970,6 +15701,22 @@ Namespace::has_func() const ARGPARSE_NOEXCEPT
     return static_cast<bool>(m_func);
 }
 
+ARGPARSE_INL std::vector<ParsedArgument>
+Namespace::items() const
+{
+    std::vector<ParsedArgument> res;
+    res.reserve(storage().m_data.size());
+    for (_Storage::const_iterator it
+         = storage().begin(); it != storage().end(); ++it) {
+        if (storage().argument_flags(*(it->first)).empty()) {
+            continue;
+        }
+        res.push_back(ParsedArgument(
+                   &(*it), static_cast<std::size_t>(it - storage().begin())));
+    }
+    return res;
+}
+
 ARGPARSE_INL void
 Namespace::print(
         std::ostream& os) const
@@ -13063,7 +15810,8 @@ Namespace::to_string() const
     for (_Storage::const_iterator it
          = storage().begin(); it != storage().end(); ++it) {
         _Storage::value_type const& pair = *it;
-        std::vector<std::string> const& str = pair.first->get_argument_flags();
+        std::vector<std::string> const& str
+                = storage().argument_flags(*(pair.first));
         if (str.empty()) {
             continue;
         }
@@ -13090,6 +15838,24 @@ Namespace::unrecognized_args_to_args() const
                 unrecognized_args(), detail::_spaces, std::string(), true);
 }
 
+ARGPARSE_INL std::vector<std::string> const&
+Namespace::values_view(
+        std::string const& key) const
+{
+    _Storage::value_type const& args = data(key);
+    detail::_check_non_count_action(key, args.first->action());
+    return args.second();
+}
+
+ARGPARSE_INL std::vector<std::string> const&
+Namespace::values_view(
+        ArgumentKey const& key) const
+{
+    _Storage::value_type const& args = data(key);
+    detail::_check_non_count_action(key.name(), args.first->action());
+    return args.second();
+}
+
 ARGPARSE_INL std::string
 Namespace::store_actions_to_string(
         _Storage::value_type const& args,
@@ -13138,24 +15904,96 @@ Namespace::data(
     throw AttributeError("'Namespace' object has no attribute '" + key + "'");
 }
 
+ARGPARSE_INL _Storage::value_type const&
+Namespace::data(
+        ArgumentKey const& key) const
+{
+    _Storage::const_iterator it = storage().find(key);
+    if (it != storage().end()) {
+        return *it;
+    }
+    throw AttributeError("'Namespace' object has no attribute '"
+                         + key.name() + "'");
+}
+
+ARGPARSE_INL _Storage::value_type const*
+Namespace::find_data(
+        std::string const& key) const
+{
+    _Storage::const_iterator it = storage().find_arg(key);
+    return it != storage().end() ? &(*it) : ARGPARSE_NULLPTR;
+}
+
+ARGPARSE_INL _Storage::value_type const*
+Namespace::find_data(
+        ArgumentKey const& key) const
+{
+    _Storage::const_iterator it = storage().find(key);
+    return it != storage().end() ? &(*it) : ARGPARSE_NULLPTR;
+}
+
 ARGPARSE_INL _Storage const&
 Namespace::storage() const ARGPARSE_NOEXCEPT
 {
-    return m_storage;
+    return m_storage.value();
 }
 
-#ifdef ARGPARSE_HAS_OPTIONAL
-ARGPARSE_INL std::optional<_Storage::value_type>
-Namespace::opt_data(
-        std::string const& key) const
+// -- ParseResult -------------------------------------------------------------
+ARGPARSE_INL
+ParseResult::ParseResult()
+    : m_namespace(),
+      m_error(),
+      m_output(),
+      m_error_argument(),
+      m_error_index(std::string::npos),
+      m_error_code(NoError),
+      m_has_value(false)
+{ }
+
+ARGPARSE_INL bool
+ParseResult::has_value() const ARGPARSE_NOEXCEPT
 {
-    auto it = storage().find_arg(key);
-    if (it != storage().end()) {
-        return *it;
+    return m_has_value;
+}
+
+ARGPARSE_INL Namespace const&
+ParseResult::value() const
+{
+    if (!m_has_value) {
+        throw std::logic_error(m_error);
     }
-    return std::nullopt;
+    return m_namespace;
+}
+
+ARGPARSE_INL std::string const&
+ParseResult::error() const ARGPARSE_NOEXCEPT
+{
+    return m_error;
+}
+
+ARGPARSE_INL ParseResult::ErrorCode
+ParseResult::error_code() const ARGPARSE_NOEXCEPT
+{
+    return m_error_code;
+}
+
+ARGPARSE_INL std::size_t
+ParseResult::error_index() const ARGPARSE_NOEXCEPT
+{
+    return m_error_index;
+}
+
+ARGPARSE_INL ArgumentKey const&
+ParseResult::error_argument() const ARGPARSE_NOEXCEPT
+{
+    return m_error_argument;
+}
+
+ARGPARSE_INL std::string const&
+ParseResult::output() const ARGPARSE_NOEXCEPT
+{
+    return m_output;
 }
-#endif  // ARGPARSE_HAS_OPTIONAL
 
 // -- _ParserGroup ------------------------------------------------------------
 ARGPARSE_INL
@@ -13242,8 +16080,8 @@ _ParserGroup::get_help(
     std::string res = help;
     std::string text;
 #ifdef ARGPARSE_CXX_11
-    std::regex const r("%[(]([a-z_]*)[)]s");
-    std::smatch match;
+    std::string::size_type pos = 0;
+    std::pair<std::string::size_type, std::string::size_type> match;
     std::unordered_map<std::string, std::function<std::string()> > const
             specifiers =
     {
@@ -13255,13 +16093,16 @@ _ParserGroup::get_help(
         { "%(required)s",
             [required](){ return detail::_bool_to_string(required); } },
     };
-    while (std::regex_search(res, match, r)) {
-        text += match.prefix();
-        auto specifier = std::string(match[0]);
+    while ((match = detail::_find_specifier(res, pos)).first
+           != std::string::npos) {
+        text.append(res, pos, match.first - pos);
+        auto specifier
+                = res.substr(match.first, match.second - match.first);
         auto it = specifiers.find(specifier);
         text += (it != specifiers.end() ? it->second() : std::move(specifier));
-        res = match.suffix();
+        pos = match.second;
     }
+    res.erase(0, pos);
 #else
     std::string const beg = "%(";
     std::string const end = ")s";
@@ -13325,8 +16166,8 @@ _ParserGroup::print_parser_group(
             std::string res = help;
             std::string text;
 #ifdef ARGPARSE_CXX_11
-            std::regex const r("%[(]([a-z_]*)[)]s");
-            std::smatch match;
+            std::string::size_type pos = 0;
+            std::pair<std::string::size_type, std::string::size_type> match;
             std::unordered_map<std::string, std::function<std::string()> > const
                     specifiers2 =
             {
@@ -13340,14 +16181,17 @@ _ParserGroup::print_parser_group(
                 { "%(option_strings)s", []() { return "[]";             } },
                 { "%(required)s",       []() { return "False";          } },
             };
-            while (std::regex_search(res, match, r)) {
-                text += match.prefix();
-                auto specifier = std::string(match[0]);
+            while ((match = detail::_find_specifier(res, pos)).first
+                   != std::string::npos) {
+                text.append(res, pos, match.first - pos);
+                auto specifier
+                        = res.substr(match.first, match.second - match.first);
                 auto it2 = specifiers2.find(specifier);
                 text += (it2 != specifiers2.end() ? it2->second()
                                                   : std::move(specifier));
-                res = match.suffix();
+                pos = match.second;
             }
+            res.erase(0, pos);
 #else
             std::string const beg = "%(";
             std::string const end = ")s";
@@ -13807,7 +16651,11 @@ ArgumentParser::read_args(
         m_prog = detail::_basename(std::string(argv[0]));
         m_parsed_arguments.reserve(std::size_t(argc - 1));
         for (int i = 1; i < argc && argv[i]; ++i) {
+#ifdef ARGPARSE_CXX_11
+            m_parsed_arguments.emplace_back(argv[i]);
+#else
             m_parsed_arguments.push_back(std::string(argv[i]));
+#endif  // C++11+
         }
     }
 }
@@ -13861,6 +16709,10 @@ ArgumentParser::ArgumentParser(
       m_prefix_chars(detail::_prefix_chars),
       m_fromfile_prefix_chars(),
       m_comment_prefix_chars(),
+      m_fromfile_max_depth(),
+      m_fromfile_max_args(),
+      m_fromfile_cache_size(detail::_cached_files),
+      m_fromfile_cache(),
       m_argument_default(),
       m_output_width(),
       m_groups(),
@@ -13876,7 +16728,9 @@ ArgumentParser::ArgumentParser(
       m_allow_abbrev(true),
       m_exit_on_error(true),
       m_suggest_on_error(false),
-      m_deprecated()
+      m_deprecated(),
+      m_plan(),
+      m_help_cache()
 {
     initialize_parser();
     this->prog(prog);
@@ -13903,6 +16757,10 @@ ArgumentParser::ArgumentParser(
       m_prefix_chars(detail::_prefix_chars),
       m_fromfile_prefix_chars(),
       m_comment_prefix_chars(),
+      m_fromfile_max_depth(),
+      m_fromfile_max_args(),
+      m_fromfile_cache_size(detail::_cached_files),
+      m_fromfile_cache(),
       m_argument_default(),
       m_output_width(),
       m_groups(),
@@ -13918,7 +16776,9 @@ ArgumentParser::ArgumentParser(
       m_allow_abbrev(true),
       m_exit_on_error(true),
       m_suggest_on_error(false),
-      m_deprecated()
+      m_deprecated(),
+      m_plan(),
+      m_help_cache()
 {
     initialize_parser();
     read_args(argc, argv);
@@ -13947,6 +16807,10 @@ ArgumentParser::ArgumentParser(
       m_prefix_chars(detail::_prefix_chars),
       m_fromfile_prefix_chars(),
       m_comment_prefix_chars(),
+      m_fromfile_max_depth(),
+      m_fromfile_max_args(),
+      m_fromfile_cache_size(detail::_cached_files),
+      m_fromfile_cache(),
       m_argument_default(),
       m_output_width(),
       m_groups(),
@@ -13962,7 +16826,9 @@ ArgumentParser::ArgumentParser(
       m_allow_abbrev(true),
       m_exit_on_error(true),
       m_suggest_on_error(false),
-      m_deprecated()
+      m_deprecated(),
+      m_plan(),
+      m_help_cache()
 {
     initialize_parser();
     read_args(argc, argv);
@@ -13980,6 +16846,7 @@ ArgumentParser::prog(
             m_subparsers->update_prog(prog(), subparsers_prog_args());
         }
     }
+    m_help_cache.clear();
     return *this;
 }
 
@@ -13989,6 +16856,7 @@ ArgumentParser::usage(
         std::string const& lang)
 {
     m_usage.will_have()[lang] = value;
+    m_help_cache.clear();
     return *this;
 }
 
@@ -13997,6 +16865,7 @@ ArgumentParser::usage(
         _SUPPRESS value)
 {
     m_usage = value;
+    m_help_cache.clear();
     return *this;
 }
 
@@ -14008,6 +16877,7 @@ ArgumentParser::usage_title(
     if (!value.empty()) {
         m_usage_title[lang] = value;
     }
+    m_help_cache.clear();
     return *this;
 }
 
@@ -14017,6 +16887,7 @@ ArgumentParser::description(
         std::string const& lang)
 {
     m_description[lang] = value;
+    m_help_cache.clear();
     return *this;
 }
 
@@ -14028,6 +16899,7 @@ ArgumentParser::positionals_title(
     if (!value.empty()) {
         m_positionals_title[lang] = value;
     }
+    m_help_cache.clear();
     return *this;
 }
 
@@ -14039,6 +16911,7 @@ ArgumentParser::operands_title(
     if (!value.empty()) {
         m_operands_title[lang] = value;
     }
+    m_help_cache.clear();
     return *this;
 }
 
@@ -14050,6 +16923,7 @@ ArgumentParser::optionals_title(
     if (!value.empty()) {
         m_optionals_title[lang] = value;
     }
+    m_help_cache.clear();
     return *this;
 }
 
@@ -14059,6 +16933,7 @@ ArgumentParser::epilog(
         std::string const& lang)
 {
     m_epilog[lang] = value;
+    m_help_cache.clear();
     return *this;
 }
 
@@ -14132,6 +17007,8 @@ ArgumentParser::parents(
         detail::_insert_to_end(parent.m_mutex_groups, m_mutex_groups);
         detail::_insert_to_end(parent.m_default_values, m_default_values);
     }
+    m_plan.reset();
+    m_help_cache.clear();
     return *this;
 }
 
@@ -14167,6 +17044,8 @@ ArgumentParser::prefix_chars(
     if (!val.empty()) {
         m_prefix_chars = ARGPARSE_MOVE(val);
         m_data->update_help(m_data->m_add_help, m_prefix_chars);
+        m_plan.reset();
+        m_help_cache.clear();
     }
     return *this;
 }
@@ -14187,6 +17066,30 @@ ArgumentParser::comment_prefix_chars(
     return *this;
 }
 
+ARGPARSE_INL ArgumentParser&
+ArgumentParser::fromfile_max_depth(
+        std::size_t value) ARGPARSE_NOEXCEPT
+{
+    m_fromfile_max_depth = value;
+    return *this;
+}
+
+ARGPARSE_INL ArgumentParser&
+ArgumentParser::fromfile_max_args(
+        std::size_t value) ARGPARSE_NOEXCEPT
+{
+    m_fromfile_max_args = value;
+    return *this;
+}
+
+ARGPARSE_INL ArgumentParser&
+ArgumentParser::fromfile_cache_size(
+        std::size_t value) ARGPARSE_NOEXCEPT
+{
+    m_fromfile_cache_size = value;
+    return *this;
+}
+
 ARGPARSE_INL ArgumentParser&
 ArgumentParser::argument_default(
         std::string const& value)
@@ -14216,6 +17119,8 @@ ArgumentParser::conflict_handler(
                              "'_handle_conflict_" + value + "'");
     }
     m_data->m_conflict_handler_str = value;
+    m_plan.reset();
+    m_help_cache.clear();
     return *this;
 }
 
@@ -14224,6 +17129,8 @@ ArgumentParser::add_help(
         bool value)
 {
     m_data->update_help(value, m_prefix_chars);
+    m_plan.reset();
+    m_help_cache.clear();
     return *this;
 }
 
@@ -14256,6 +17163,7 @@ ArgumentParser::color(
         bool value) ARGPARSE_NOEXCEPT
 {
     m_formatter->m_color = value;
+    m_help_cache.clear();
     return *this;
 }
 
@@ -14272,6 +17180,7 @@ ArgumentParser::output_width(
         std::size_t value) ARGPARSE_NOEXCEPT
 {
     m_output_width = value < detail::_min_width ? detail::_min_width : value;
+    m_help_cache.clear();
     return *this;
 }
 
@@ -14359,6 +17268,24 @@ ArgumentParser::comment_prefix_chars() const ARGPARSE_NOEXCEPT
     return m_comment_prefix_chars;
 }
 
+ARGPARSE_INL std::size_t
+ArgumentParser::fromfile_max_depth() const ARGPARSE_NOEXCEPT
+{
+    return m_fromfile_max_depth;
+}
+
+ARGPARSE_INL std::size_t
+ArgumentParser::fromfile_max_args() const ARGPARSE_NOEXCEPT
+{
+    return m_fromfile_max_args;
+}
+
+ARGPARSE_INL std::size_t
+ArgumentParser::fromfile_cache_size() const ARGPARSE_NOEXCEPT
+{
+    return m_fromfile_cache_size;
+}
+
 ARGPARSE_INL std::string const&
 ArgumentParser::argument_default() const ARGPARSE_NOEXCEPT
 {
@@ -14485,6 +17412,8 @@ ArgumentParser::add_argument_group(
                 title, description, m_prefix_chars, m_data,
                 m_argument_default, m_mutex_groups);
     m_groups.push_back(pGroup(group));
+    m_plan.reset();
+    m_help_cache.clear();
     return *group;
 }
 
@@ -14495,6 +17424,8 @@ ArgumentParser::add_mutually_exclusive_group(
     m_mutex_groups.push_back(
                 MutuallyExclusiveGroup::make_mutex_group(
                     m_prefix_chars, m_data, m_argument_default));
+    m_plan.reset();
+    m_help_cache.clear();
     return m_mutex_groups.back().required(required);
 }
 
@@ -14511,6 +17442,8 @@ ArgumentParser::add_subparsers(
     m_subparsers->update_prog(prog(), subparsers_prog_args());
     m_subparsers->m_color = color();
     m_groups.push_back(pGroup(m_subparsers));
+    m_plan.reset();
+    m_help_cache.clear();
     return *m_subparsers;
 }
 
@@ -14562,6 +17495,24 @@ ArgumentParser::get_default(
     return std::string();
 }
 
+ARGPARSE_INL ArgumentKey
+ArgumentParser::key(
+        std::string const& name) const
+{
+    _Storage created;
+    if (!m_plan) {
+        create_storage(created);
+    }
+    _Storage const& storage = m_plan ? m_plan->storage : created;
+    _Storage::const_iterator it = storage.find_arg(name);
+    if (it == storage.end()) {
+        throw AttributeError("'ArgumentParser' object has no attribute '"
+                             + name + "'");
+    }
+    return ArgumentKey(it->first.get(),
+                       static_cast<std::size_t>(it - storage.begin()), name);
+}
+
 #ifdef ARGPARSE_CXX_11
 ARGPARSE_INL ArgumentParser&
 ArgumentParser::set_defaults(
@@ -14585,6 +17536,8 @@ ArgumentParser::set_defaults(
             m_default_values.push_back(std::make_pair(dest, value));
         }
     }
+    // the default values of the arguments are shown in help
+    m_help_cache.clear();
     return *this;
 }
 
@@ -14596,6 +17549,36 @@ ArgumentParser::set_defaults_func(
     return *this;
 }
 
+ARGPARSE_INL ArgumentParser&
+ArgumentParser::freeze()
+{
+    m_plan.reset();
+    m_help_cache.clear();
+    check_mutex_arguments();
+    ParserInfo info = parser_info(
+                this, detail::CowValue<_Storage>(), subparsers_info(true));
+    info.flags->build_abbrevs(*info.optional);
+    _Storage storage;
+    create_storage(storage);
+    storage.update_slots();
+    storage.update_names();
+    m_plan = detail::make_shared<ParsePlan>(
+                ParsePlan(info, m_data->get_positional(true, true), storage));
+    if (m_subparsers) {
+        for (prs_iterator it = m_subparsers->m_parsers.begin();
+             it != m_subparsers->m_parsers.end(); ++it) {
+            (*it)->freeze();
+        }
+    }
+    return *this;
+}
+
+ARGPARSE_INL bool
+ArgumentParser::frozen() const ARGPARSE_NOEXCEPT
+{
+    return m_plan.get();
+}
+
 ARGPARSE_INL Namespace
 ArgumentParser::parse_args(
         Namespace const& space) const
@@ -14606,17 +17589,53 @@ ArgumentParser::parse_args(
 ARGPARSE_INL Namespace
 ArgumentParser::parse_args(
         std::string const& args,
-        Namespace const& space) const
+        Namespace const& space) const
+{
+    return parse_args(split_to_args(args), space);
+}
+
+ARGPARSE_INL Namespace
+ArgumentParser::parse_args(
+        std::vector<std::string> const& args,
+        Namespace const& space) const
+{
+    return on_parse_arguments(detail::_tokens(args), false, false, space);
+}
+
+ARGPARSE_INL Namespace
+ArgumentParser::parse_args(
+        int argc,
+        char const* const argv[],
+        Namespace const& space) const
+{
+    return on_parse_arguments(detail::_tokens(argc, argv), false, false, space);
+}
+
+ARGPARSE_INL Namespace&
+ArgumentParser::update_args(
+        std::string const& args,
+        Namespace& space) const
 {
-    return parse_args(split_to_args(args), space);
+    return update_args(split_to_args(args), space);
 }
 
-ARGPARSE_INL Namespace
-ArgumentParser::parse_args(
+ARGPARSE_INL Namespace&
+ArgumentParser::update_args(
         std::vector<std::string> const& args,
-        Namespace const& space) const
+        Namespace& space) const
 {
-    return on_parse_arguments(args, false, false, space);
+    std::vector<detail::token> tokens = detail::_tokens(args);
+    if (!m_exit_on_error) {
+        return update_arguments(tokens, space);
+    }
+    try {
+        return update_arguments(tokens, space);
+    } catch (std::exception& e) {
+        std::cerr << e.what() << std::endl;
+    } catch (...) {
+        std::cerr << "argparse error: unexpected error" << std::endl;
+    }
+    std::exit(1);
 }
 
 ARGPARSE_INL Namespace
@@ -14639,7 +17658,16 @@ ArgumentParser::parse_known_args(
         std::vector<std::string> const& args,
         Namespace const& space) const
 {
-    return on_parse_arguments(args, true, false, space);
+    return on_parse_arguments(detail::_tokens(args), true, false, space);
+}
+
+ARGPARSE_INL Namespace
+ArgumentParser::parse_known_args(
+        int argc,
+        char const* const argv[],
+        Namespace const& space) const
+{
+    return on_parse_arguments(detail::_tokens(argc, argv), true, false, space);
 }
 
 ARGPARSE_INL Namespace
@@ -14662,7 +17690,7 @@ ArgumentParser::parse_intermixed_args(
         std::vector<std::string> const& args,
         Namespace const& space) const
 {
-    return on_parse_arguments(args, false, true, space);
+    return on_parse_arguments(detail::_tokens(args), false, true, space);
 }
 
 ARGPARSE_INL Namespace
@@ -14685,7 +17713,7 @@ ArgumentParser::parse_known_intermixed_args(
         std::vector<std::string> const& args,
         Namespace const& space) const
 {
-    return on_parse_arguments(args, true, true, space);
+    return on_parse_arguments(detail::_tokens(args), true, true, space);
 }
 
 #ifdef ARGPARSE_CXX_11
@@ -14697,6 +17725,14 @@ ArgumentParser::parse_args(
     return parse_args(std::vector<std::string>{ args }, space);
 }
 
+ARGPARSE_INL Namespace&
+ArgumentParser::update_args(
+        std::initializer_list<std::string> const& args,
+        Namespace& space) const
+{
+    return update_args(std::vector<std::string>{ args }, space);
+}
+
 ARGPARSE_INL Namespace
 ArgumentParser::parse_known_args(
         std::initializer_list<std::string> const& args,
@@ -14751,7 +17787,7 @@ ArgumentParser::try_parse_args(
         std::vector<std::string> const& args,
         Namespace const& space) const
 {
-    return on_try_parse_arguments(args, false, false, space);
+    return on_try_parse_arguments(detail::_tokens(args), false, false, space);
 }
 
 ARGPARSE_INL std::optional<Namespace>
@@ -14782,7 +17818,7 @@ ArgumentParser::try_parse_known_args(
         std::vector<std::string> const& args,
         Namespace const& space) const
 {
-    return on_try_parse_arguments(args, true, false, space);
+    return on_try_parse_arguments(detail::_tokens(args), true, false, space);
 }
 
 ARGPARSE_INL std::optional<Namespace>
@@ -14814,7 +17850,7 @@ ArgumentParser::try_parse_intermixed_args(
         std::vector<std::string> const& args,
         Namespace const& space) const
 {
-    return on_try_parse_arguments(args, false, true, space);
+    return on_try_parse_arguments(detail::_tokens(args), false, true, space);
 }
 
 ARGPARSE_INL std::optional<Namespace>
@@ -14846,10 +17882,118 @@ ArgumentParser::try_parse_known_intermixed_args(
         std::vector<std::string> const& args,
         Namespace const& space) const
 {
-    return on_try_parse_arguments(args, true, true, space);
+    return on_try_parse_arguments(detail::_tokens(args), true, true, space);
 }
 #endif  // ARGPARSE_HAS_OPTIONAL
 
+ARGPARSE_INL ParseResult
+ArgumentParser::parse_one(
+        std::string const& command_line) const
+{
+    std::stringstream os;
+    std::vector<std::string> const args = split_to_args(command_line, os);
+    ParseResult res = parse_one(args);
+    res.m_output.insert(0, os.str());
+    return res;
+}
+
+ARGPARSE_INL ParseResult
+ArgumentParser::parse_one(
+        std::vector<std::string> const& args) const
+{
+    ParseResult res;
+    try_parse_item(args, res);
+    return res;
+}
+
+ARGPARSE_INL std::vector<ParseResult>
+ArgumentParser::parse_many(
+        std::vector<std::string> const& command_lines,
+        std::size_t jobs) const
+{
+    std::vector<std::vector<std::string> > args;
+    std::vector<std::string> outputs;
+    args.reserve(command_lines.size());
+    outputs.reserve(command_lines.size());
+    for (std::size_t i = 0; i < command_lines.size(); ++i) {
+        std::stringstream os;
+        args.push_back(split_to_args(command_lines[i], os));
+        outputs.push_back(os.str());
+    }
+    std::vector<ParseResult> res = parse_many(args, jobs);
+    for (std::size_t i = 0; i < res.size(); ++i) {
+        res[i].m_output.insert(0, outputs[i]);
+    }
+    return res;
+}
+
+ARGPARSE_INL std::vector<ParseResult>
+ArgumentParser::parse_many(
+        std::vector<std::vector<std::string> > const& args,
+        std::size_t jobs) const
+{
+    std::vector<ParseResult> res(args.size());
+#ifdef ARGPARSE_CXX_11
+    if (jobs == 0) {
+        jobs = std::thread::hardware_concurrency();
+    }
+#endif  // C++11+
+    detail::_limit_to_max(jobs, args.size());
+#ifdef ARGPARSE_CXX_11
+    if (jobs > 1) {
+        std::atomic<std::size_t> next(0);
+        auto const worker = [this, &args, &res, &next] ()
+        {
+            for (std::size_t i = next++; i < args.size(); i = next++) {
+                try_parse_item(args[i], res[i]);
+            }
+        };
+        std::vector<std::thread> threads;
+        threads.reserve(jobs - 1);
+        try {
+            for (std::size_t t = 1; t < jobs; ++t) {
+                threads.emplace_back(worker);
+            }
+        } catch (std::system_error const&) {
+            // no more threads can be started, the command lines are parsed
+            // with the started ones and the calling thread
+        }
+        // the calling thread parses the command lines too, try_parse_item
+        // doesn't throw, so the started threads are always joined
+        worker();
+        for (std::size_t t = 0; t < threads.size(); ++t) {
+            threads[t].join();
+        }
+        return res;
+    }
+#endif  // C++11+
+    for (std::size_t i = 0; i < args.size(); ++i) {
+        try_parse_item(args[i], res[i]);
+    }
+    return res;
+}
+
+ARGPARSE_INL void
+ArgumentParser::try_parse_item(
+        std::vector<std::string> const& args,
+        ParseResult& res) const
+{
+    std::stringstream os;
+    try {
+        std::vector<detail::token> tokens = detail::_tokens(args);
+        res.m_namespace
+                = parse_arguments(tokens, false, false, Namespace(), os, &res);
+        res.m_has_value = res.m_error_code == ParseResult::NoError;
+    } catch (std::exception& e) {
+        res.m_error_code = ParseResult::OtherError;
+        res.m_error = e.what();
+    } catch (...) {
+        res.m_error_code = ParseResult::OtherError;
+        res.m_error = "argparse error: unexpected error";
+    }
+    res.m_output += os.str();
+}
+
 ARGPARSE_INL bool
 ArgumentParser::has_env(
         std::string const& name) const
@@ -14890,9 +18034,9 @@ ArgumentParser::print_usage(
         std::string const& language,
         std::ostream& os) const
 {
-    detail::colorstream cs = m_formatter->_format_usage(this, language);
-    if (!cs.text().empty()) {
-        cs.print(os);
+    pHelpText const usage = help_text(true, language);
+    if (!usage->text.empty()) {
+        usage->print(os);
         os << std::endl;
     }
 }
@@ -14909,9 +18053,9 @@ ArgumentParser::print_help(
         std::string const& language,
         std::ostream& os) const
 {
-    detail::colorstream cs = m_formatter->_format_help(this, language);
-    if (!cs.text().empty()) {
-        cs.print(os);
+    pHelpText const help = help_text(false, language);
+    if (!help->text.empty()) {
+        help->print(os);
         os << std::endl;
     }
 }
@@ -14920,14 +18064,14 @@ ARGPARSE_INL std::string
 ArgumentParser::format_usage(
         std::string const& lang) const
 {
-    return m_formatter->_format_usage(this, lang).colored();
+    return help_text(true, lang)->colored;
 }
 
 ARGPARSE_INL std::string
 ArgumentParser::format_help(
         std::string const& lang) const
 {
-    return m_formatter->_format_help(this, lang).colored();
+    return help_text(false, lang)->colored;
 }
 
 ARGPARSE_INL void
@@ -14970,21 +18114,167 @@ ArgumentParser::default_language() const
     return res;
 }
 
+ARGPARSE_INL
+ArgumentParser::FlagIndex::FlagIndex(
+        pArguments const& optional,
+        pArguments const& operand)
+    : keys(detail::make_shared<std::deque<std::string> >()),
+      optional(),
+      operand(),
+      max_size(0),
+      abbrevs(),
+      short_sizes(),
+      abbrevs_built(false)
+{
+    add_flags(this->optional, optional);
+    add_flags(this->operand, operand);
+}
+
+ARGPARSE_INL void
+ArgumentParser::FlagIndex::add_flags(
+        flag_map& map,
+        pArguments const& arguments)
+{
+    for (std::size_t i = 0; i < arguments.size(); ++i) {
+        std::vector<std::string> const& flags = arguments.at(i)->flags();
+        for (std::size_t j = 0; j < flags.size(); ++j) {
+            // keep the first argument with the flag, as the linear search did
+            keys->push_back(flags.at(j));
+            map.insert(std::make_pair(detail::token(keys->back()),
+                                      arguments.at(i)));
+            max_size = std::max(max_size, flags.at(j).size());
+        }
+    }
+}
+
+ARGPARSE_INL ArgumentParser::pArgument const
+ArgumentParser::FlagIndex::find(
+        flag_map const& map,
+        detail::token const& flag) const
+{
+    if (flag.size() > max_size) {
+        return ARGPARSE_NULLPTR;
+    }
+    flag_map::const_iterator it = map.find(flag);
+    return it != map.end() ? it->second : ARGPARSE_NULLPTR;
+}
+
+ARGPARSE_INL bool
+ArgumentParser::FlagIndex::abbrev_less(
+        Abbrev const& lhs,
+        Abbrev const& rhs)
+{
+    return lhs.flag < rhs.flag;
+}
+
+ARGPARSE_INL bool
+ArgumentParser::FlagIndex::abbrev_flag_less(
+        Abbrev const& lhs,
+        std::string const& flag)
+{
+    return lhs.flag < flag;
+}
+
+ARGPARSE_INL bool
+ArgumentParser::FlagIndex::abbrev_option_less(
+        Abbrev const* lhs,
+        Abbrev const* rhs)
+{
+    return lhs->option < rhs->option
+            || (lhs->option == rhs->option && lhs->index < rhs->index);
+}
+
+ARGPARSE_INL void
+ArgumentParser::FlagIndex::build_abbrevs(
+        pArguments const& arguments) const
+{
+    if (abbrevs_built) {
+        return;
+    }
+    abbrevs_built = true;
+    for (std::size_t i = 0; i < arguments.size(); ++i) {
+        std::vector<std::string> const& flags = arguments.at(i)->flags();
+        for (std::size_t j = 0; j < flags.size(); ++j) {
+            Abbrev abbrev = { flags.at(j), i, j,
+                              detail::_utf8_length(flags.at(j)).second == 2 };
+            if (abbrev.is_short
+                    && !detail::_exists(abbrev.flag.size(), short_sizes)) {
+                short_sizes.push_back(abbrev.flag.size());
+            }
+            abbrevs.push_back(abbrev);
+        }
+    }
+    std::sort(abbrevs.begin(), abbrevs.end(), abbrev_less);
+}
+
+ARGPARSE_INL void
+ArgumentParser::FlagIndex::find_abbrevs(
+        pArguments const& arguments,
+        std::string const& arg,
+        std::vector<Abbrev const*>& res) const
+{
+    build_abbrevs(arguments);
+    std::vector<Abbrev const*> matches;
+    // flags that starts with arg are stored in the continuous range
+    std::vector<Abbrev>::const_iterator it = std::lower_bound(
+                abbrevs.begin(), abbrevs.end(), arg, abbrev_flag_less);
+    for ( ; it != abbrevs.end() && detail::_starts_with(it->flag, arg); ++it) {
+        matches.push_back(&*it);
+    }
+    // short flags that arg starts with
+    for (std::size_t i = 0; i < short_sizes.size(); ++i) {
+        if (short_sizes.at(i) > arg.size()) {
+            continue;
+        }
+        std::string const prefix = arg.substr(0, short_sizes.at(i));
+        it = std::lower_bound(
+                    abbrevs.begin(), abbrevs.end(), prefix, abbrev_flag_less);
+        for ( ; it != abbrevs.end() && it->flag == prefix; ++it) {
+            if (it->is_short) {
+                matches.push_back(&*it);
+            }
+        }
+    }
+    // keep the first matched flag for each option in the options order
+    std::sort(matches.begin(), matches.end(), abbrev_option_less);
+    for (std::size_t i = 0; i < matches.size(); ++i) {
+        if (res.empty() || res.back()->option != matches.at(i)->option) {
+            res.push_back(matches.at(i));
+        }
+    }
+}
+
 ARGPARSE_INL
 ArgumentParser::ParserInfo::ParserInfo(
         ArgumentParser const* parser,
-        _Storage const& storage,
+        detail::CowValue<_Storage> const& storage,
         SubParsersInfo const& subparsers,
         pArguments const& optional,
         pArguments const& operand)
     : parser(parser),
-      optional(optional),
-      operand(operand),
+      optional(detail::make_shared<pArguments>(optional)),
+      operand(detail::make_shared<pArguments>(operand)),
+      required(detail::make_shared<pArguments>()),
+      flags(detail::make_shared<FlagIndex>(FlagIndex(optional, operand))),
       storage(storage),
+      arguments(),
       subparsers(subparsers),
       lang(),
-      has_negative_args()
+      has_negative_args(),
+      err(&std::cerr),
+      result(),
+      values_index(std::string::npos)
 {
+    for (std::size_t i = 0; i < optional.size(); ++i) {
+        if (optional.at(i)->required()) {
+            required->push_back(optional.at(i));
+        }
+    }
+    for (std::size_t i = 0; i < operand.size(); ++i) {
+        if (operand.at(i)->required()) {
+            required->push_back(operand.at(i));
+        }
+    }
     lang = parser->default_language();
     has_negative_args = detail::_negative_numbers_presented(
                 optional, parser->prefix_chars());
@@ -14996,10 +18286,16 @@ ArgumentParser::ParserInfo::ParserInfo(
     : parser(orig.parser),
       optional(orig.optional),
       operand(orig.operand),
+      required(orig.required),
+      flags(orig.flags),
       storage(orig.storage),
+      arguments(orig.arguments),
       subparsers(orig.subparsers),
       lang(orig.lang),
-      has_negative_args(orig.has_negative_args)
+      has_negative_args(orig.has_negative_args),
+      err(orig.err),
+      result(orig.result),
+      values_index(orig.values_index)
 { }
 
 ARGPARSE_INL ArgumentParser::ParserInfo&
@@ -15010,20 +18306,323 @@ ArgumentParser::ParserInfo::operator =(
         parser              = rhs.parser;
         optional            = rhs.optional;
         operand             = rhs.operand;
+        required            = rhs.required;
+        flags               = rhs.flags;
         storage             = rhs.storage;
+        arguments           = rhs.arguments;
         subparsers          = rhs.subparsers;
         lang                = rhs.lang;
         has_negative_args   = rhs.has_negative_args;
+        err                 = rhs.err;
+        result              = rhs.result;
+        values_index        = rhs.values_index;
+    }
+    return *this;
+}
+
+ARGPARSE_INL bool
+ArgumentParser::ParserInfo::failed() const ARGPARSE_NOEXCEPT
+{
+    return result && result->m_error_code != ParseResult::NoError;
+}
+
+ARGPARSE_INL void
+ArgumentParser::ParserInfo::error_index(
+        std::size_t index) const ARGPARSE_NOEXCEPT
+{
+    if (result && result->m_error_code == ParseResult::NoError) {
+        result->m_error_index = index;
+    }
+}
+
+ARGPARSE_INL void
+ArgumentParser::ParserInfo::value_error_index(
+        std::size_t offset) const ARGPARSE_NOEXCEPT
+{
+    if (values_index != std::string::npos) {
+        error_index(values_index + offset);
+    }
+}
+
+ARGPARSE_INL void
+ArgumentParser::ParserInfo::skip_values(
+        std::size_t count) ARGPARSE_NOEXCEPT
+{
+    if (values_index != std::string::npos) {
+        values_index += count;
+    }
+}
+
+ARGPARSE_INL
+ArgumentParser::FromfileArgs::FromfileArgs()
+    : mtime(-1),
+      size(-1),
+      args(),
+      used()
+{ }
+
+ARGPARSE_INL
+ArgumentParser::FromfileCache::FromfileCache()
+    : files(),
+      uses()
+#ifdef ARGPARSE_CXX_11
+    , mutex()
+#endif  // C++11+
+{ }
+
+ARGPARSE_INL
+ArgumentParser::FromfileCache::FromfileCache(
+        FromfileCache const& orig)
+    : files(),
+      uses()
+#ifdef ARGPARSE_CXX_11
+    , mutex()
+#endif  // C++11+
+{
+#ifdef ARGPARSE_CXX_11
+    std::lock_guard<std::mutex> lock(orig.mutex);
+#endif  // C++11+
+    files = orig.files;
+    uses = orig.uses;
+}
+
+ARGPARSE_INL ArgumentParser::FromfileCache&
+ArgumentParser::FromfileCache::operator =(
+        FromfileCache const& rhs)
+{
+    if (this != &rhs) {
+        FromfileCache tmp(rhs);
+#ifdef ARGPARSE_CXX_11
+        std::lock_guard<std::mutex> lock(mutex);
+#endif  // C++11+
+        files.swap(tmp.files);
+        uses = tmp.uses;
+    }
+    return *this;
+}
+
+ARGPARSE_INL ArgumentParser::pFileArgs
+ArgumentParser::FromfileCache::find(
+        std::string const& path,
+        int64_t mtime,
+        int64_t size)
+{
+#ifdef ARGPARSE_CXX_11
+    std::lock_guard<std::mutex> lock(mutex);
+#endif  // C++11+
+    detail::hash_map<std::string, FromfileArgs>::type::iterator it
+            = files.find(path);
+    if (it != files.end()
+            && it->second.mtime == mtime && it->second.size == size) {
+        it->second.used = ++uses;
+        return it->second.args;
+    }
+    return pFileArgs();
+}
+
+ARGPARSE_INL void
+ArgumentParser::FromfileCache::insert(
+        std::string const& path,
+        int64_t mtime,
+        int64_t size,
+        pFileArgs const& args,
+        std::size_t limit)
+{
+#ifdef ARGPARSE_CXX_11
+    std::lock_guard<std::mutex> lock(mutex);
+#endif  // C++11+
+    typedef detail::hash_map<std::string, FromfileArgs>::type file_map;
+    // the cache is bounded, the least recently used file is dropped
+    // for the new one
+    if (files.find(path) == files.end()) {
+        while (!files.empty() && files.size() >= limit) {
+            file_map::iterator oldest = files.begin();
+            for (file_map::iterator it = files.begin();
+                 it != files.end(); ++it) {
+                if (it->second.used < oldest->second.used) {
+                    oldest = it;
+                }
+            }
+            files.erase(oldest);
+        }
+        if (limit == 0) {
+            return;
+        }
+    }
+    FromfileArgs& entry = files[path];
+    entry.mtime = mtime;
+    entry.size = size;
+    entry.args = args;
+    entry.used = ++uses;
+}
+
+ARGPARSE_INL
+ArgumentParser::TokenArena::TokenArena()
+    : strings(),
+      files()
+{ }
+
+ARGPARSE_INL void
+ArgumentParser::TokenArena::keep(
+        std::vector<std::string>& values,
+        std::vector<detail::token>& res)
+{
+#ifdef ARGPARSE_HAS_STRING_VIEW
+    res.reserve(values.size());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        strings.push_back(std::move(values[i]));
+        res.push_back(strings.back());
+    }
+#else
+    res.swap(values);
+#endif  // ARGPARSE_HAS_STRING_VIEW
+}
+
+ARGPARSE_INL
+ArgumentParser::HelpText::HelpText(
+        detail::colorstream const& text)
+    : text(text),
+      colored(text.colored())
+{ }
+
+ARGPARSE_INL void
+ArgumentParser::HelpText::print(
+        std::ostream& os) const
+{
+#ifdef _WIN32
+    // console colors are set while printing
+    text.print(os);
+#else
+    os << colored;
+#endif  // _WIN32
+}
+
+ARGPARSE_INL
+ArgumentParser::HelpCache::HelpCache()
+    : texts()
+#ifdef ARGPARSE_CXX_11
+    , mutex()
+#endif  // C++11+
+{ }
+
+ARGPARSE_INL
+ArgumentParser::HelpCache::HelpCache(
+        HelpCache const& orig)
+    : texts()
+#ifdef ARGPARSE_CXX_11
+    , mutex()
+#endif  // C++11+
+{
+#ifdef ARGPARSE_CXX_11
+    std::lock_guard<std::mutex> lock(orig.mutex);
+#endif  // C++11+
+    texts = orig.texts;
+}
+
+ARGPARSE_INL ArgumentParser::HelpCache&
+ArgumentParser::HelpCache::operator =(
+        HelpCache const& rhs)
+{
+    if (this != &rhs) {
+        HelpCache tmp(rhs);
+#ifdef ARGPARSE_CXX_11
+        std::lock_guard<std::mutex> lock(mutex);
+#endif  // C++11+
+        texts.swap(tmp.texts);
+    }
+    return *this;
+}
+
+ARGPARSE_INL ArgumentParser::pHelpText
+ArgumentParser::HelpCache::find(
+        std::string const& key) const
+{
+#ifdef ARGPARSE_CXX_11
+    std::lock_guard<std::mutex> lock(mutex);
+#endif  // C++11+
+    detail::hash_map<std::string, pHelpText>::type::const_iterator it
+            = texts.find(key);
+    return it != texts.end() ? it->second : pHelpText();
+}
+
+ARGPARSE_INL void
+ArgumentParser::HelpCache::insert(
+        std::string const& key,
+        pHelpText const& text)
+{
+#ifdef ARGPARSE_CXX_11
+    std::lock_guard<std::mutex> lock(mutex);
+#endif  // C++11+
+    texts[key] = text;
+}
+
+ARGPARSE_INL void
+ArgumentParser::HelpCache::clear()
+{
+#ifdef ARGPARSE_CXX_11
+    std::lock_guard<std::mutex> lock(mutex);
+#endif  // C++11+
+    texts.clear();
+}
+
+ARGPARSE_INL
+ArgumentParser::ParsePlan::ParsePlan(
+        ParserInfo const& info,
+        pArguments const& positional,
+        _Storage const& storage)
+    : info(info),
+      positional(positional),
+      storage(storage),
+      suppressed(),
+      bound(),
+      choices(),
+      parser_names()
+{
+    bool suggest = info.parser->m_suggest_on_error;
+    for (_Storage::const_iterator it = storage.begin();
+         it != storage.end(); ++it) {
+        if (it->first->m_default.suppress()) {
+            suppressed.push_back(it->first);
+        }
+        if (it->first->m_binder) {
+            bound.push_back(it->first);
+        }
+        if (suggest && it->first->m_choices.has_value()) {
+            choices.insert(std::make_pair(
+                    it->first.get(),
+                    detail::make_shared<detail::CloseMatches>(
+                        detail::CloseMatches(
+                            it->first->m_choices.value()))));
+        }
     }
-    return *this;
+    if (suggest && info.subparsers.first) {
+        parser_names = detail::make_shared<detail::CloseMatches>(
+                    detail::CloseMatches(
+                        info.subparsers.first->parser_names()));
+    }
+}
+
+ARGPARSE_INL detail::CloseMatches const*
+ArgumentParser::ParsePlan::find_choices(
+        Argument const* arg) const
+{
+    choices_map::const_iterator it = choices.find(arg);
+    return it != choices.end() ? it->second.get() : ARGPARSE_NULLPTR;
 }
 
 ARGPARSE_INL ArgumentParser::ParserInfo
 ArgumentParser::parser_info(
         ArgumentParser const* parser,
-        _Storage const& storage,
+        detail::CowValue<_Storage> const& storage,
         SubParsersInfo const& subparsers)
 {
+    if (parser->m_plan) {
+        ParserInfo res = parser->m_plan->info;
+        res.parser = parser;
+        res.storage = storage;
+        res.subparsers = subparsers;
+        return res;
+    }
     pArguments optional = parser->m_data->get_optional(true, true);
     pArguments operand = parser->m_data->get_operand(true, true);
     for (mtx_it i = parser->m_mutex_groups.begin();
@@ -15056,6 +18655,33 @@ ArgumentParser::throw_error(
     throw std::logic_error(prog() + ": error: " + message);
 }
 
+ARGPARSE_INL void
+ArgumentParser::report_error(
+        ParserInfo const& info,
+        ParseResult::ErrorCode code,
+        std::string const& message,
+        Argument const* arg,
+        std::string const& lang)
+{
+    if (!info.result) {
+        info.parser->throw_error(message, lang, *info.err);
+    }
+    if (info.failed()) {
+        return;
+    }
+    // the caller stops the parsing, the first error is kept
+    ParseResult& res = *info.result;
+    info.parser->print_usage(
+                !lang.empty() ? lang : info.parser->default_language(),
+                *info.err);
+    res.m_error_code = code;
+    res.m_error = info.parser->prog() + ": error: " + message;
+    if (arg) {
+        res.m_error_argument = ArgumentKey(arg, std::string::npos,
+                                           arg->get_dest());
+    }
+}
+
 ARGPARSE_INL std::string
 ArgumentParser::despecify(
         std::string const& str) const
@@ -15063,9 +18689,38 @@ ArgumentParser::despecify(
     return detail::_replace(str, "%(prog)s", prog());
 }
 
+ARGPARSE_INL ArgumentParser::pHelpText
+ArgumentParser::help_text(
+        bool usage,
+        std::string const& language) const
+{
+    std::string const lang = !language.empty() ? language : default_language();
+    // the texts of the frozen parser are rendered once per language,
+    // output width and color
+    std::string key;
+    pHelpText res;
+    if (m_plan) {
+        key = usage ? "u" : "h";
+        key += detail::colorstream(color()).colorize() ? "c" : "n";
+        key += detail::_to_string(output_width()) + ":" + lang;
+        res = m_help_cache.find(key);
+    }
+    if (!res) {
+        res = detail::make_shared<HelpText>(HelpText(
+                    usage ? m_formatter->_format_usage(this, lang)
+                          : m_formatter->_format_help(this, lang)));
+        if (m_plan) {
+            m_help_cache.insert(key, res);
+        }
+    }
+    return res;
+}
+
 ARGPARSE_INL void
 ArgumentParser::process_add_argument()
 {
+    m_plan.reset();
+    m_help_cache.clear();
     if (m_argument_default.has_value()
             && !m_data->m_arguments.back()->m_default.has_value()
             && !m_data->m_arguments.back()->m_default.suppress()) {
@@ -15094,7 +18749,7 @@ ArgumentParser::process_add_argument()
 
 ARGPARSE_INL Namespace
 ArgumentParser::on_parse_arguments(
-        std::vector<std::string> const& args,
+        std::vector<detail::token> args,
         bool only_known,
         bool intermixed,
         Namespace const& space) const
@@ -15115,7 +18770,7 @@ ArgumentParser::on_parse_arguments(
 #ifdef ARGPARSE_HAS_OPTIONAL
 ARGPARSE_INL std::optional<Namespace>
 ArgumentParser::on_try_parse_arguments(
-        std::vector<std::string> const& args,
+        std::vector<detail::token> args,
         bool only_known,
         bool intermixed,
         Namespace const& space) const
@@ -15131,107 +18786,293 @@ ArgumentParser::on_try_parse_arguments(
 }
 #endif  // ARGPARSE_HAS_OPTIONAL
 
-ARGPARSE_INL std::vector<std::string>
+ARGPARSE_INL void
 ArgumentParser::read_args_from_file(
-        std::vector<std::string> const& arguments) const
-{
-    std::vector<std::string> res = arguments;
-    if (!fromfile_prefix_chars().empty()) {
-        for (std::size_t i = 0; i < res.size(); ++i) {
-            while (!res.at(i).empty()
-                   && detail::_exists(res.at(i).at(0),
-                                      fromfile_prefix_chars())) {
-                std::string file = res.at(i).substr(1);
-                std::ifstream is(file.c_str());
-                if (!is.is_open()) {
-                    throw_error("[Errno 2] No such file or directory: '"
-                                + file + "'");
-                }
-                std::vector<std::string> args;
-                std::string line;
-                while (std::getline(is, line)) {
-                    std::vector<std::string> line_args
-                            = convert_arg_line_to_args(line);
-                    detail::_move_insert_to_end(line_args, args);
-                }
-                is.close();
-                detail::_move_replace_at(args, res, i);
-            }
+        ParserInfo const& info,
+        std::vector<detail::token>& arguments,
+        TokenArena& arena) const
+{
+    if (fromfile_prefix_chars().empty() && comment_prefix_chars().empty()) {
+        return;
+    }
+    std::vector<detail::token> res;
+    res.reserve(arguments.size());
+    std::vector<std::string> files;
+    for (std::size_t i = 0; i < arguments.size() && !info.failed(); ++i) {
+        expand_arg(info, arguments[i], files, res, arena);
+    }
+    arguments.swap(res);
+}
+
+ARGPARSE_INL void
+ArgumentParser::expand_arg(
+        ParserInfo const& info,
+        detail::token const& arg,
+        std::vector<std::string>& files,
+        std::vector<detail::token>& res,
+        TokenArena& arena) const
+{
+    if (!arg.empty() && detail::_exists(arg[0], fromfile_prefix_chars())) {
+        read_args_file(info, detail::_token_str(arg.substr(1)),
+                       files, res, arena);
+        return;
+    }
+    if (!arg.empty() && detail::_exists(arg[0], comment_prefix_chars())) {
+        return;
+    }
+    res.push_back(arg);
+}
+
+ARGPARSE_INL void
+ArgumentParser::read_args_file(
+        ParserInfo const& info,
+        std::string const& file,
+        std::vector<std::string>& files,
+        std::vector<detail::token>& res,
+        TokenArena& arena) const
+{
+    std::string path;
+    int64_t mtime = 0;
+    int64_t size = 0;
+    if (!detail::_file_stat(file, path, mtime, size)) {
+        report_error(info, ParseResult::FromfileError,
+                     "[Errno 2] No such file or directory: '" + file + "'");
+        return;
+    }
+    if (std::find(files.begin(), files.end(), path) != files.end()) {
+        report_error(info, ParseResult::FromfileError,
+                     "recursive fromfile arguments file: '" + file + "'");
+        return;
+    }
+    if (m_fromfile_max_depth != 0 && files.size() >= m_fromfile_max_depth) {
+        report_error(info, ParseResult::FromfileError,
+                     "fromfile arguments files nested too deeply: '"
+                     + file + "'");
+        return;
+    }
+    pFileArgs args = load_args_file(info, file, path, mtime, size);
+    if (!args) {
+        return;
+    }
+    // the file arguments are kept alive while the tokens point to them
+    arena.files.push_back(args);
+    files.push_back(path);
+    for (std::size_t i = 0; i < args->size(); ++i) {
+        expand_arg(info, args->at(i), files, res, arena);
+        if (info.failed()) {
+            return;
+        }
+        if (m_fromfile_max_args != 0 && res.size() > m_fromfile_max_args) {
+            report_error(info, ParseResult::FromfileError,
+                         "too many arguments in fromfile arguments file: '"
+                         + file + "'");
+            return;
         }
     }
-    if (!comment_prefix_chars().empty()) {
-        // remove comments
-        std::vector<std::string>::iterator first = res.begin();
-        std::vector<std::string>::iterator it = first;
-        while (first != res.end()) {
-            if (first->empty()
-                    || !detail::_exists(first->at(0), comment_prefix_chars())) {
-                if (it != first) {
-                    *it = ARGPARSE_MOVE(*first);
-                }
-                ++it;
-            }
-            ++first;
+    files.pop_back();
+}
+
+ARGPARSE_INL ArgumentParser::pFileArgs
+ArgumentParser::load_args_file(
+        ParserInfo const& info,
+        std::string const& file,
+        std::string const& path,
+        int64_t mtime,
+        int64_t size) const
+{
+    // only regular files are cached, other files can't be read twice,
+    // recently modified files are read again
+    pFileArgs res;
+    if (size >= 0 && m_fromfile_cache_size != 0) {
+        res = m_fromfile_cache.find(path, mtime, size);
+    }
+    if (res) {
+        return res;
+    }
+    std::ifstream is(file.c_str());
+    if (!is.is_open()) {
+        report_error(info, ParseResult::FromfileError,
+                     "[Errno 2] No such file or directory: '" + file + "'");
+        return pFileArgs();
+    }
+    // read the whole file until the end (pipes and FIFOs have no size),
+    // then split it into lines
+    std::string buffer;
+    if (size > 0) {
+        buffer.reserve(static_cast<std::size_t>(size));
+    }
+    char chunk[4096];
+    do {
+        is.read(chunk, static_cast<std::streamsize>(sizeof(chunk)));
+        buffer.append(chunk, static_cast<std::size_t>(is.gcount()));
+    } while (is);
+    is.close();
+    res = detail::make_shared<std::vector<std::string> >();
+    std::vector<std::string>& args = *res;
+    std::string::size_type pos = 0;
+    while (pos < buffer.size()) {
+        std::string::size_type end = buffer.find('\n', pos);
+        if (end == std::string::npos) {
+            end = buffer.size();
+        }
+        std::vector<std::string> line_args
+                = convert_arg_line_to_args(buffer.substr(pos, end - pos));
+        for (std::size_t i = 0; i < line_args.size(); ++i) {
+            args.push_back(ARGPARSE_MOVE(line_args[i]));
+        }
+        if (m_fromfile_max_args != 0 && args.size() > m_fromfile_max_args) {
+            report_error(info, ParseResult::FromfileError,
+                         "too many arguments in fromfile arguments file: '"
+                         + file + "'");
+            return pFileArgs();
         }
-        res.erase(it, res.end());
+        pos = end + 1;
+    }
+    if (size >= 0 && !detail::_file_recently_modified(mtime)) {
+        m_fromfile_cache.insert(path, mtime, size, res,
+                                m_fromfile_cache_size);
     }
     return res;
 }
 
 ARGPARSE_INL Namespace
 ArgumentParser::parse_arguments(
-        std::vector<std::string> const& in_args,
+        std::vector<detail::token>& in_args,
         bool only_known,
         bool intermixed,
-        Namespace const& space) const
+        Namespace const& space,
+        std::ostream& err,
+        ParseResult* result) const
 {
     handle(prog());
     check_namespace(space);
-    std::vector<std::string> parsed_arguments = read_args_from_file(in_args);
 
     Parsers parsers;
     parsers.push_back(
-                parser_info(this, space.storage(), subparsers_info(true)));
+                parser_info(this, space.m_storage, subparsers_info(true)));
+    parsers.back().err = &err;
+    parsers.back().result = result;
+    std::vector<std::string> unrecognized_args;
+    process_arguments(in_args, only_known, intermixed, false,
+                      parsers, unrecognized_args);
+    if (parsers.front().failed()) {
+        return Namespace();
+    }
+    return create_namespace(only_known, parsers.back().parser->m_default_func,
+                            ARGPARSE_MOVE(parsers.front().storage),
+                            ARGPARSE_MOVE(unrecognized_args));
+}
 
-    check_mutex_arguments();
+ARGPARSE_INL Namespace&
+ArgumentParser::update_arguments(
+        std::vector<detail::token>& in_args,
+        Namespace& space) const
+{
+    handle(prog());
+    check_namespace(space);
+
+    Parsers parsers;
+    parsers.push_back(parser_info(this, detail::CowValue<_Storage>(),
+                                  subparsers_info(true)));
+    // take the namespace storage, not shared storage is changed in place,
+    // the touched values are saved to restore them if the update failed
+    parsers.back().storage.swap(space.m_storage);
+    bool const saved = !parsers.back().storage.value().empty();
+    if (saved) {
+        parsers.back().storage.data().begin_update();
+    }
+    std::vector<std::string> unrecognized_args;
+    try {
+        process_arguments(in_args, false, false, true,
+                          parsers, unrecognized_args);
+    } catch (...) {
+        if (saved) {
+            parsers.front().storage.data().rollback_update();
+            space.m_storage.swap(parsers.front().storage);
+        }
+        throw;
+    }
+    if (saved) {
+        parsers.front().storage.data().commit_update();
+    }
+    space.m_storage.swap(parsers.front().storage);
+    if (parsers.size() > 1) {
+        space.m_func = parsers.back().parser->m_default_func;
+    }
+    return space;
+}
+
+ARGPARSE_INL void
+ArgumentParser::process_arguments(
+        std::vector<detail::token>& parsed_arguments,
+        bool only_known,
+        bool intermixed,
+        bool update,
+        Parsers& parsers,
+        std::vector<std::string>& unrecognized_args) const
+{
+    TokenArena arena;
+    read_args_from_file(parsers.back(), parsed_arguments, arena);
+    if (parsers.front().failed()) {
+        return;
+    }
+
+    if (!m_plan) {
+        check_mutex_arguments();
+    }
     detail::_check_intermixed_subparsers(
                 intermixed, parsers.back().subparsers.first);
 
-    pArguments positional = m_data->get_positional(true, true);
+    pArguments positional = m_plan ? m_plan->positional
+                                   : m_data->get_positional(true, true);
     check_intermixed_remainder(intermixed, positional);
 
-    parsers.back().storage.create(m_data->get_arguments(true), true);
-    for (mtx_it i = m_mutex_groups.begin(); i != m_mutex_groups.end(); ++i) {
-        parsers.back().storage.create((*i).m_data->get_arguments(true), true);
+    // the namespace made by the frozen parser has all its arguments,
+    // except the suppressed ones
+    bool const incremental
+            = update && m_plan && !parsers.back().storage.value().empty();
+    pArguments suppressed;
+    if (m_plan && parsers.back().storage.value().empty()) {
+        parsers.back().storage = detail::CowValue<_Storage>(m_plan->storage);
+    } else if (incremental) {
+        restore_suppressed(parsers.back().storage, suppressed);
+    } else {
+        create_storage(parsers.back().storage.data());
     }
 
-    std::vector<std::string> unrecognized_args;
     std::list<std::string> intermixed_args;
+    std::size_t unrecognized_index = std::string::npos;
 
     bool was_pseudo_arg = false;
     std::size_t pos = 0;
+    std::vector<detail::token> equals;
     for (std::size_t i = 0; i < parsed_arguments.size(); ++i) {
         if (parsed_arguments.at(i) == detail::_pseudo_arg && !was_pseudo_arg) {
             was_pseudo_arg = true;
             continue;
         }
-        check_abbreviations(parsers, was_pseudo_arg, parsed_arguments, i);
+        parsers.front().error_index(i);
+        check_abbreviations(parsers, was_pseudo_arg, parsed_arguments, i,
+                            arena);
+        if (parsers.front().failed()) {
+            return;
+        }
         bool remainder = is_remainder_positional(pos, positional, parsers);
-        std::string arg = parsed_arguments.at(i);
-        std::vector<std::string> equals = detail::_process_split_equal(
-                    arg, parsers.back().parser->prefix_chars());
+        detail::token const& arg = detail::_process_split_equal(
+                    parsed_arguments.at(i),
+                    parsers.back().parser->prefix_chars(), equals);
         pArgument const tmp
                 = get_optional_arg_by_flag(was_pseudo_arg, parsers.back(), arg);
         if (tmp && !remainder) {
             if (tmp->deprecated()) {
                 switch (tmp->m_type) {
                     case Argument::Optional :
-                        std::cerr << parsers.back().parser->prog()
+                        *parsers.back().err << parsers.back().parser->prog()
                                   << ": warning: option '" << arg
                                   << "' is deprecated" << std::endl;
                         break;
                     case Argument::Operand :
-                        std::cerr << parsers.back().parser->prog()
+                        *parsers.back().err << parsers.back().parser->prog()
                                   << ": warning: operand '" << arg
                                   << "' is deprecated" << std::endl;
                         break;
@@ -15241,7 +19082,7 @@ ArgumentParser::parse_arguments(
             }
             switch (tmp->action()) {
                 case argparse::store :
-                    parsers.front().storage.at(tmp).clear();
+                    parsers.front().storage.data().at(tmp).clear();
                     // fallthrough
                 case argparse::append :
                 case argparse::extend :
@@ -15255,11 +19096,13 @@ ArgumentParser::parse_arguments(
                     process_optional_version(parsers.back(), equals, arg, tmp);
                     break;
                 case argparse::language :
-                    parsers.front().storage.at(tmp).clear();
+                    parsers.front().storage.data().at(tmp).clear();
                     storage_optional_store(parsers, equals, parsed_arguments,
                                            i, was_pseudo_arg, arg, tmp);
-                    parsers.back().lang
-                            = parsers.front().storage.at(tmp).front();
+                    if (!parsers.front().failed()) {
+                        parsers.back().lang
+                            = parsers.front().storage.value().at(tmp).front();
+                    }
                     break;
                 default :
                     // argparse::store_const :
@@ -15276,25 +19119,81 @@ ArgumentParser::parse_arguments(
                    && detail::_is_optional(
                        arg, parsers.back().parser->prefix_chars(),
                        parsers.back().has_negative_args, was_pseudo_arg)) {
-            unrecognized_args.push_back(ARGPARSE_MOVE(arg));
+            if (unrecognized_args.empty()) {
+                unrecognized_index = i;
+            }
+            unrecognized_args.push_back(detail::_token_str(arg));
         } else {
+            std::size_t const unrecognized = unrecognized_args.size();
             process_positional_args(parsed_arguments, i, parsers,
                                     was_pseudo_arg, intermixed, intermixed_args,
                                     pos, positional, unrecognized_args);
+            if (unrecognized == 0 && !unrecognized_args.empty()) {
+                // not matched arguments are at the end of the positional
+                unrecognized_index
+                        = std::min(i + 1, parsed_arguments.size())
+                        - unrecognized_args.size();
+            }
+        }
+        if (parsers.front().failed()) {
+            return;
         }
     }
+    parsers.front().error_index(std::string::npos);
     if (!intermixed_args.empty()) {
         match_args_partial(parsers, pos, positional, unrecognized_args,
                            intermixed_args);
     }
-    check_mutex_groups(parsers);
-    check_required_args(parsers, pos, positional);
-    check_unrecognized_args(only_known, unrecognized_args);
-    default_values_post_trigger(parsers.front().storage);
+    if (!parsers.front().failed()) {
+        check_mutex_groups(parsers);
+    }
+    if (!parsers.front().failed()) {
+        check_required_args(parsers, pos, positional, update);
+    }
+    parsers.front().error_index(unrecognized_index);
+    check_unrecognized_args(parsers.front(), only_known, unrecognized_args);
+    if (parsers.front().failed()) {
+        return;
+    }
+    // the parse results (parse_one, parse_many) can be made on several
+    // threads at once, so the bound variables aren't written for them
+    bool const bind = !parsers.front().result;
+    if (incremental) {
+        suppressed_post_trigger(parsers.front().storage, suppressed);
+        if (bind) {
+            bind_values(parsers);
+        }
+    } else {
+        default_values_post_trigger(parsers.front().storage.data());
+        if (bind) {
+            bind_values(parsers.front().storage.value());
+        }
+    }
     namespace_post_trigger(parsers, only_known, unrecognized_args);
-    return create_namespace(only_known, parsers.back().parser->m_default_func,
-                            ARGPARSE_MOVE(parsers.front().storage),
-                            ARGPARSE_MOVE(unrecognized_args));
+}
+
+ARGPARSE_INL void
+ArgumentParser::create_storage(
+        _Storage& storage) const
+{
+    storage.create(m_data->get_arguments(true), true);
+    for (mtx_it i = m_mutex_groups.begin(); i != m_mutex_groups.end(); ++i) {
+        storage.create((*i).m_data->get_arguments(true), true);
+    }
+}
+
+ARGPARSE_INL void
+ArgumentParser::restore_suppressed(
+        detail::CowValue<_Storage>& storage,
+        pArguments& suppressed) const
+{
+    pArguments const& arguments = m_plan->suppressed;
+    for (std::size_t i = 0; i < arguments.size(); ++i) {
+        if (!storage.value().exists(arguments.at(i))) {
+            storage.data().create(arguments.at(i));
+            suppressed.push_back(arguments.at(i));
+        }
+    }
 }
 
 ARGPARSE_INL void
@@ -15341,7 +19240,7 @@ ARGPARSE_INL Namespace
 ArgumentParser::create_namespace(
         bool only_known,
         detail::func1<Namespace const&>::type func,
-        detail::rval<_Storage>::type storage,
+        detail::rval<detail::CowValue<_Storage> >::type storage,
         detail::rval<std::vector<std::string> >::type unrecognized_args)
 {
     return only_known ? Namespace(ARGPARSE_MOVE(storage), ARGPARSE_MOVE(func),
@@ -15351,18 +19250,43 @@ ArgumentParser::create_namespace(
 
 ARGPARSE_INL void
 ArgumentParser::validate_argument_value(
-        ArgumentParser const* parser,
+        ParserInfo const& info,
         Argument const& arg,
         std::string const& value) const
 {
     if (!(arg.m_nargs & (detail::REMAINDING | detail::SUPPRESSING))
-            && arg.m_choices.has_value()) {
-        if (!value.empty() && !detail::_exists(value, arg.m_choices.value())) {
-            parser->throw_error(
-                        "argument " + (arg.m_flags.empty()
-                                       ? arg.dest() : arg.m_flags.front())
-                        + detail::_invalid_choice(
-                            value, arg.m_choices.value(), m_suggest_on_error));
+            && arg.m_choices.has_value() && !value.empty()) {
+        // the choices set is built once by Argument::choices()
+        if (arg.m_choices_set->find(value) == arg.m_choices_set->end()) {
+            report_error(info, ParseResult::InvalidChoice,
+                         "argument " + (arg.m_flags.empty()
+                                        ? arg.dest() : arg.m_flags.front())
+                         + detail::_invalid_choice(
+                             value, arg.m_choices.value(), m_suggest_on_error,
+                             info.parser->m_plan
+                             ? info.parser->m_plan->find_choices(&arg)
+                             : ARGPARSE_NULLPTR),
+                         &arg);
+        }
+    }
+}
+
+ARGPARSE_INL void
+ArgumentParser::report_invalid_type(
+        ParserInfo const& info,
+        Argument const& arg,
+        std::vector<std::string> const& values)
+{
+    detail::shared_ptr<detail::TypedValues> typed(arg.m_typed->clone());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        if (!typed->push_back(values.at(i))) {
+            info.value_error_index(i);
+            report_error(info, ParseResult::InvalidValue,
+                         "argument " + (arg.m_flags.empty()
+                                        ? arg.dest() : arg.m_flags.front())
+                         + ": invalid " + typed->type_name() + " value: '"
+                         + values.at(i) + "'", &arg);
+            return;
         }
     }
 }
@@ -15372,8 +19296,11 @@ ArgumentParser::storage_have_value(
         Parsers& parsers,
         pArgument const& arg) const
 {
-    validate_argument_value(parsers.back().parser, *arg, std::string());
-    parsers.front().storage.have_value(arg);
+    validate_argument_value(parsers.back(), *arg, std::string());
+    if (parsers.back().failed()) {
+        return;
+    }
+    parsers.front().storage.data().have_value(arg);
 }
 
 ARGPARSE_INL void
@@ -15383,8 +19310,16 @@ ArgumentParser::storage_store_value(
         std::string const& value) const
 {
     std::string val = detail::_remove_quotes(value);
-    validate_argument_value(parsers.back().parser, *arg, val);
-    parsers.front().storage.store_value(arg, val);
+    parsers.back().value_error_index(0);
+    validate_argument_value(parsers.back(), *arg, val);
+    if (parsers.back().failed()) {
+        return;
+    }
+    if (!parsers.front().storage.data().store_value(arg, val)) {
+        report_invalid_type(parsers.back(), *arg,
+                           std::vector<std::string>(1, val));
+    }
+    parsers.back().skip_values(1);
 }
 
 ARGPARSE_INL void
@@ -15396,9 +19331,15 @@ ArgumentParser::storage_store_values(
     std::vector<std::string> vals = values;
     for (std::size_t i = 0; i < vals.size(); ++i) {
         vals.at(i) = detail::_remove_quotes(vals.at(i));
-        validate_argument_value(parsers.back().parser, *arg, vals.at(i));
+        parsers.back().value_error_index(i);
+        validate_argument_value(parsers.back(), *arg, vals.at(i));
+    }
+    if (parsers.back().failed()) {
+        return;
+    }
+    if (!parsers.front().storage.data().store_values(arg, vals)) {
+        report_invalid_type(parsers.back(), *arg, vals);
     }
-    parsers.front().storage.store_values(arg, vals);
 }
 
 ARGPARSE_INL void
@@ -15417,7 +19358,15 @@ ArgumentParser::storage_store_n_values(
         arg->push_value(arguments.front(), values);
         arguments.pop_front();
     }
+    std::size_t const index = parsers.back().values_index;
+    if (values.size() != n) {
+        // the values aren't the tokens, errors point to the first token
+        parsers.back().value_error_index(0);
+        parsers.back().values_index = std::string::npos;
+    }
     storage_store_values(parsers, arg, values);
+    parsers.back().values_index = index;
+    parsers.back().skip_values(n);
 }
 
 ARGPARSE_INL void
@@ -15425,7 +19374,7 @@ ArgumentParser::storage_store_default_value(
         Parsers& parsers,
         pArgument const& arg) const
 {
-    parsers.front().storage.store_default_value(arg);
+    parsers.front().storage.data().store_default_value(arg);
 }
 
 ARGPARSE_INL bool
@@ -15433,13 +19382,13 @@ ArgumentParser::storage_is_positional_arg_stored(
         Parsers& parsers,
         pArgument const& arg) const
 {
-    return parsers.front().storage.self_value_stored(arg);
+    return parsers.front().storage.data().self_value_stored(arg);
 }
 
 ARGPARSE_INL void
 ArgumentParser::storage_optional_store_func(
         Parsers& parsers,
-        std::string const& arg,
+        detail::token const& arg,
         pArgument const& tmp,
         std::size_t n) const
 {
@@ -15448,7 +19397,9 @@ ArgumentParser::storage_optional_store_func(
             case detail::NARGS_DEF :
             case detail::NARGS_NUM :
             case detail::ONE_OR_MORE :
-                parsers.back().parser->throw_error(tmp->error_nargs(arg));
+                report_error(parsers.back(), ParseResult::ExpectedArguments,
+                             tmp->error_nargs(detail::_token_str(arg)),
+                             tmp.get());
                 break;
             case detail::ZERO_OR_ONE :
                 if (tmp->m_const.has_value()) {
@@ -15459,8 +19410,12 @@ ArgumentParser::storage_optional_store_func(
                         std::vector<std::string> values;
                         tmp->push_value(tmp->const_value(), values);
                         if ((values.size() % tmp->m_num_args) != 0) {
-                            parsers.back().parser->throw_error(
-                                        tmp->error_nargs(arg));
+                            report_error(parsers.back(),
+                                         ParseResult::ExpectedArguments,
+                                         tmp->error_nargs(
+                                             detail::_token_str(arg)),
+                                         tmp.get());
+                            return;
                         }
                         storage_store_values(parsers, tmp, values);
                     }
@@ -15483,24 +19438,28 @@ ArgumentParser::storage_optional_store_func(
                && (n < tmp->m_num_args
                    || (tmp->m_nargs != detail::NARGS_NUM
                        && tmp->m_num_args > 1 && (n % tmp->m_num_args) != 0))) {
-        parsers.back().parser->throw_error(tmp->error_nargs(arg));
+        report_error(parsers.back(), ParseResult::ExpectedArguments,
+                     tmp->error_nargs(detail::_token_str(arg)), tmp.get());
     }
 }
 
 ARGPARSE_INL void
 ArgumentParser::storage_optional_store(
         Parsers& parsers,
-        std::vector<std::string> const& equals,
-        std::vector<std::string> const& args,
+        std::vector<detail::token> const& equals,
+        std::vector<detail::token> const& args,
         std::size_t& i,
         bool was_pseudo_arg,
-        std::string const& arg,
+        detail::token const& arg,
         pArgument const& tmp) const
 {
-    if (equals.size() == 1) {
+    if (equals.empty()) {
         if (tmp->m_type == Argument::Operand) {
-            parsers.back().parser->throw_error(
-                        "argument " + arg + " is operand: expected A=...");
+            report_error(parsers.back(), ParseResult::ExpectedArguments,
+                         "argument " + detail::_token_str(arg)
+                         + " is operand: expected A=...",
+                         tmp.get());
+            return;
         }
         std::size_t n = 0;
         std::vector<std::string> values;
@@ -15510,11 +19469,11 @@ ArgumentParser::storage_optional_store(
                 storage_optional_store_func(parsers, arg, tmp, n);
                 break;
             } else {
-                std::string const& next = args.at(i);
+                detail::token const& next = args.at(i);
                 if (tmp->m_nargs != detail::SUPPRESSING
                         && (tmp->m_nargs == detail::REMAINDING
-                            || (detail::_is_not_operand(
-                                   was_pseudo_arg, parsers.back().operand, next)
+                            || (is_not_operand(
+                                   was_pseudo_arg, parsers.back(), next)
                                 && detail::_not_optional(
                                     next,
                                     parsers.back().parser->prefix_chars(),
@@ -15548,31 +19507,42 @@ ArgumentParser::storage_optional_store(
                     break;
             }
         } while (read_next);
-        if (!values.empty()) {
+        if (!values.empty() && !parsers.back().failed()) {
             storage_store_values(parsers, tmp, values);
         }
     } else {
         if (tmp->m_nargs == detail::SUPPRESSING) {
-            parsers.back().parser->throw_error(
-                       detail::_ignore_explicit(equals.front(), equals.back()));
+            report_error(parsers.back(), ParseResult::IgnoredExplicitArgument,
+                         detail::_ignore_explicit(
+                             equals.front(), equals.back()), tmp.get());
+            return;
         }
         std::vector<std::string> values;
         tmp->push_value(equals.back(), values);
         switch (tmp->m_nargs) {
             case detail::ONE_OR_MORE :
                 if (values.empty()) {
-                    parsers.back().parser->throw_error(tmp->error_nargs(arg));
+                    report_error(parsers.back(), ParseResult::ExpectedArguments,
+                                 tmp->error_nargs(detail::_token_str(arg)),
+                                 tmp.get());
+                    return;
                 }
                 // fallthrough
             case detail::ZERO_OR_ONE :
             case detail::ZERO_OR_MORE :
                 if ((values.size() % tmp->m_num_args) != 0) {
-                    parsers.back().parser->throw_error(tmp->error_nargs(arg));
+                    report_error(parsers.back(), ParseResult::ExpectedArguments,
+                                 tmp->error_nargs(detail::_token_str(arg)),
+                                 tmp.get());
+                    return;
                 }
                 break;
             case detail::NARGS_NUM :
                 if (values.size() != tmp->m_num_args) {
-                    parsers.back().parser->throw_error(tmp->error_nargs(arg));
+                    report_error(parsers.back(), ParseResult::ExpectedArguments,
+                                 tmp->error_nargs(detail::_token_str(arg)),
+                                 tmp.get());
+                    return;
                 }
                 break;
         }
@@ -15583,37 +19553,47 @@ ArgumentParser::storage_optional_store(
 ARGPARSE_INL void
 ArgumentParser::storage_optional_store_const(
         Parsers& parsers,
-        std::vector<std::string> const& equals,
-        std::string const& arg,
+        std::vector<detail::token> const& equals,
+        detail::token const& arg,
         pArgument const& tmp) const
 {
-    if (equals.size() == 1) {
+    if (equals.empty()) {
         if (tmp->action() == argparse::BooleanOptionalAction) {
-            bool exist = detail::_exists(equals.front(), tmp->m_flags);
+            bool exist
+                    = detail::_exists(detail::_token_str(arg), tmp->m_flags);
             storage_store_value(parsers, tmp,
                                 exist ? tmp->const_value() : std::string());
         } else {
-            parsers.front().storage.self_value_stored(tmp);
+            parsers.front().storage.data().self_value_stored(tmp);
         }
     } else {
-        parsers.back().parser->throw_error(
-                    detail::_ignore_explicit(arg, equals.back()));
+        report_error(parsers.back(), ParseResult::IgnoredExplicitArgument,
+                     detail::_ignore_explicit(arg, equals.back()), tmp.get());
     }
 }
 
 ARGPARSE_INL void
 ArgumentParser::process_optional_help(
         ParserInfo const& info,
-        std::vector<std::string> const& equals,
-        std::string const& arg,
+        std::vector<detail::token> const& equals,
+        detail::token const& arg,
         pArgument const& tmp) const
 {
-    if (equals.size() != 1) {
-        info.parser->throw_error(
-                    detail::_ignore_explicit(arg, equals.back()), info.lang);
+    if (!equals.empty()) {
+        report_error(info, ParseResult::IgnoredExplicitArgument,
+                     detail::_ignore_explicit(arg, equals.back()),
+                     tmp.get(), info.lang);
+        return;
     }
-    // print help and exit
     tmp->handle(std::string());
+    if (info.result) {
+        // the help is stored to the parse result output, the caller stops
+        // the parsing
+        info.parser->print_help(info.lang, *info.err);
+        info.result->m_error_code = ParseResult::Help;
+        return;
+    }
+    // print help and exit
     info.parser->print_help(info.lang);
     exit(0);
 }
@@ -15621,20 +19601,29 @@ ArgumentParser::process_optional_help(
 ARGPARSE_INL void
 ArgumentParser::process_optional_version(
         ParserInfo const& info,
-        std::vector<std::string> const& equals,
-        std::string const& arg,
+        std::vector<detail::token> const& equals,
+        detail::token const& arg,
         pArgument const& tmp) const
 {
-    if (equals.size() != 1) {
-        info.parser->throw_error(
-                    detail::_ignore_explicit(arg, equals.back()), info.lang);
+    if (!equals.empty()) {
+        report_error(info, ParseResult::IgnoredExplicitArgument,
+                     detail::_ignore_explicit(arg, equals.back()),
+                     tmp.get(), info.lang);
+        return;
     }
     if (!tmp->m_version.has_value()) {
         throw
         AttributeError("'ArgumentParser' object has no attribute 'version'");
     }
-    // print version and exit
     tmp->handle(std::string());
+    if (info.result) {
+        // the version is stored to the parse result output, the caller
+        // stops the parsing
+        *info.err << despecify(tmp->version()) << std::endl;
+        info.result->m_error_code = ParseResult::Version;
+        return;
+    }
+    // print version and exit
     std::cout << despecify(tmp->version()) << std::endl;
     exit(0);
 }
@@ -15654,7 +19643,7 @@ ArgumentParser::match_positional_minimum(
         return;
     }
     if (arg->action() == argparse::store) {
-        parsers.front().storage.at(arg).clear();
+        parsers.front().storage.data().at(arg).clear();
     }
     switch (arg->m_nargs) {
         case detail::NARGS_DEF :
@@ -15692,7 +19681,7 @@ ArgumentParser::match_positional_more_zero(
         return;
     }
     if (arg->action() == argparse::store) {
-        parsers.front().storage.at(arg).clear();
+        parsers.front().storage.data().at(arg).clear();
     }
     switch (arg->m_nargs) {
         case detail::NARGS_DEF :
@@ -15742,7 +19731,7 @@ ArgumentParser::match_positional_optional(
         return;
     }
     if (arg->action() == argparse::store) {
-        parsers.front().storage.at(arg).clear();
+        parsers.front().storage.data().at(arg).clear();
     }
     switch (arg->m_nargs) {
         case detail::NARGS_DEF :
@@ -15785,7 +19774,7 @@ ArgumentParser::match_positional_default(
         return;
     }
     if (arg->action() == argparse::store) {
-        parsers.front().storage.at(arg).clear();
+        parsers.front().storage.data().at(arg).clear();
     }
     if (arg->m_nargs == detail::NARGS_DEF) {
         storage_store_value(parsers, arg, arguments.front());
@@ -15810,7 +19799,7 @@ ArgumentParser::match_positionals(
         return;
     }
     if (positional.at(pos)->deprecated()) {
-        std::cerr << parsers.back().parser->prog()
+        *parsers.back().err << parsers.back().parser->prog()
                   << ": warning: argument '" << positional.at(pos)->get_dest()
                   << "' is deprecated" << std::endl;
     }
@@ -15947,6 +19936,9 @@ ArgumentParser::try_capture_parser(
     }
     match_positionals(parsers, pos, positional, args, finish,
                       ++min_args, one_args, more_args);
+    if (parsers.back().failed()) {
+        return false;
+    }
     std::string const& name = args.front();
     pSubParsers const& last = parsers.back().subparsers.first;
     std::string const& dest = last->dest();
@@ -15954,29 +19946,37 @@ ArgumentParser::try_capture_parser(
     for (prs_iterator it = lst_parsers.begin(); it != lst_parsers.end(); ++it) {
         if ((*it)->m_name == name || detail::_exists(name, (*it)->aliases())) {
             if ((*it)->deprecated()) {
-                std::cerr << parsers.back().parser->prog()
+                *parsers.back().err << parsers.back().parser->prog()
                           << ": warning: command '" << name
                           << "' is deprecated" << std::endl;
             }
             std::string const& lang = parsers.back().lang;
-            parsers.push_back(parser_info((*it).get(), _Storage(),
+            std::ostream* err = parsers.back().err;
+            parsers.push_back(parser_info((*it).get(),
+                                          detail::CowValue<_Storage>(),
                                           (*it)->subparsers_info(true, pos)));
+            parsers.back().err = err;
+            parsers.back().result = parsers.front().result;
             if (!lang.empty()) {
                 parsers.back().lang = lang;
             }
             parsers.back().parser->handle(parsers.back().parser->m_name);
+            // values are stored in the first parser storage only, subparser
+            // namespaces are made from it in namespace_post_trigger
+            _Storage& storage = parsers.front().storage.data();
+            pArguments& arguments = parsers.back().arguments;
             if (!dest.empty()) {
                 pArgument subparsers_arg = Argument::make_argument(
                             detail::_vector(dest), dest, Argument::Positional);
-                for (pi_iterator j = parsers.begin(); j != parsers.end(); ++j) {
-                    (*j).storage.create(subparsers_arg);
-                }
-                parsers.front().storage.at(subparsers_arg).push_back(name);
-            }
-            for (pi_iterator j = parsers.begin(); j != parsers.end(); ++j) {
-                (*j).storage.create(
-                      parsers.back().parser->m_data->get_arguments(true), true);
+                storage.create(subparsers_arg);
+                storage.at(subparsers_arg).push_back(name);
+                storage.at(subparsers_arg).parsed(true);
+                arguments.push_back(subparsers_arg);
             }
+            pArguments const sub_arguments
+                    = parsers.back().parser->m_data->get_arguments(true);
+            storage.create(sub_arguments, true);
+            detail::_insert_to_end(sub_arguments, arguments);
             pArguments sub_positional
                     = parsers.back().parser->m_data->get_positional(true, true);
             detail::_move_insert_to(sub_positional, positional, pos);
@@ -15984,8 +19984,14 @@ ArgumentParser::try_capture_parser(
             return true;
         }
     }
-    throw_error("argument " + last->flags_to_string() + detail::_invalid_choice(
-                    name, last->parser_names(), m_suggest_on_error));
+    parsers.back().value_error_index(0);
+    report_error(parsers.front(), ParseResult::InvalidChoice,
+                 "argument " + last->flags_to_string()
+                 + detail::_invalid_choice(
+                     name, last->parser_names(), m_suggest_on_error,
+                     parsers.back().parser->m_plan
+                     ? parsers.back().parser->m_plan->parser_names.get()
+                     : ARGPARSE_NULLPTR));
     return false;
 }
 
@@ -15993,58 +19999,63 @@ ARGPARSE_INL void
 ArgumentParser::check_abbreviations(
         Parsers const& parsers,
         bool was_pseudo_arg,
-        std::vector<std::string>& arguments,
-        std::size_t i) const
+        std::vector<detail::token>& arguments,
+        std::size_t i,
+        TokenArena& arena) const
 {
-    std::string const& arg = arguments.at(i);
-    if (!arg.empty() && !parsers.front().storage.exists(arg)
-            && detail::_is_optional(arg,
-                                    parsers.back().parser->prefix_chars(),
-                                    parsers.back().has_negative_args,
-                                    was_pseudo_arg)) {
-        pArguments const& options = parsers.back().optional;
+    if (!detail::_is_optional(arguments.at(i),
+                              parsers.back().parser->prefix_chars(),
+                              parsers.back().has_negative_args,
+                              was_pseudo_arg)) {
+        return;
+    }
+    ParserInfo const& info = parsers.back();
+    // the flags of the parser are found without the token copy
+    if (info.flags->find(info.flags->optional, arguments.at(i))) {
+        return;
+    }
+    std::string const& arg = detail::_token_str(arguments.at(i));
+    if (!parsers.front().storage.value().exists(arg)) {
         std::vector<std::string> temp;
         if (m_allow_abbrev) {
             bool is_flag_added = false;
-            std::string args;
             std::vector<std::string> keys;
             keys.reserve(4);
-            for (std::size_t j = 0; j < options.size(); ++j) {
-                pArgument const& opt = options.at(j);
-                for (std::size_t k = 0; k < opt->flags().size(); ++k) {
-                    std::string const& flag = opt->flags().at(k);
-                    if (detail::_starts_with(flag, arg)) {
-                        is_flag_added = true;
-                        keys.push_back(flag);
-                        detail::_append_value_to(detail::_spaces + flag,
-                                                 args, ",");
-                        break;
-                    }
-                    if (detail::_utf8_length(flag).second == 2
-                            && detail::_starts_with(arg, flag)) {
-                        keys.push_back(arg);
-                        detail::_append_value_to(detail::_spaces + flag,
-                                                 args, ",");
-                        break;
-                    }
+            std::vector<FlagIndex::Abbrev const*> abbrevs;
+            info.flags->find_abbrevs(*info.optional, arg, abbrevs);
+            for (std::size_t j = 0; j < abbrevs.size(); ++j) {
+                std::string const& flag = abbrevs.at(j)->flag;
+                if (detail::_starts_with(flag, arg)) {
+                    is_flag_added = true;
+                    keys.push_back(flag);
+                } else {
+                    keys.push_back(arg);
                 }
             }
             if (keys.size() > 1) {
-                parsers.back().parser->throw_error(
-                          "ambiguous option: '" + arg + "' could match" + args);
+                std::string args;
+                for (std::size_t j = 0; j < abbrevs.size(); ++j) {
+                    detail::_append_value_to(
+                                detail::_spaces + abbrevs.at(j)->flag,
+                                args, ",");
+                }
+                report_error(info, ParseResult::AmbiguousOption,
+                             "ambiguous option: '" + arg
+                             + "' could match" + args);
+                return;
             }
             std::string const& flag = keys.empty() ? arg : keys.front();
             if (is_flag_added) {
                 temp.push_back(flag);
             } else {
-                separate_arg_abbrev(parsers.back(), temp, arg,
-                                    detail::_flag_name(flag), options);
+                separate_arg_abbrev(info, temp, arg, detail::_flag_name(flag));
             }
         } else {
-            separate_arg_abbrev(parsers.back(), temp, arg,
-                                detail::_flag_name(arg), options);
+            separate_arg_abbrev(info, temp, arg, detail::_flag_name(arg));
         }
-        detail::_move_replace_at(temp, arguments, i);
+        std::vector<detail::token> tokens;
+        arena.keep(temp, tokens);
+        detail::_move_replace_at(tokens, arguments, i);
     }
 }
 
@@ -16056,21 +20067,37 @@ ArgumentParser::is_remainder_positional(
 {
     return pos < positional.size()
             && positional.at(pos)->m_nargs == detail::REMAINDING
-            && !parsers.front().storage.at(positional.at(pos)).empty();
+            && !parsers.front().storage.value().at(positional.at(pos)).empty();
 }
 
 ARGPARSE_INL ArgumentParser::pArgument const
 ArgumentParser::get_optional_arg_by_flag(
         bool was_pseudo_arg,
         ParserInfo const& info,
-        std::string const& key)
+        detail::token const& key)
 {
     if (was_pseudo_arg) {
         return ARGPARSE_NULLPTR;
     }
-    pArgument const opt = detail::_find_arg_by_flag(info.optional, key);
+    pArgument const opt = info.flags->find(info.flags->optional, key);
     return opt ? ARGPARSE_MOVE(opt)
-               : detail::_find_arg_by_flag(info.operand, key);
+               : info.flags->find(info.flags->operand, key);
+}
+
+ARGPARSE_INL bool
+ArgumentParser::is_not_operand(
+        bool was_pseudo_arg,
+        ParserInfo const& info,
+        detail::token const& key)
+{
+    if (was_pseudo_arg) {
+        return true;
+    }
+    std::string::size_type const equal = key.find(detail::_equal);
+    if (equal == std::string::npos) {
+        return !info.flags->find(info.flags->operand, key);
+    }
+    return !info.flags->find(info.flags->operand, key.substr(0, equal));
 }
 
 ARGPARSE_INL void
@@ -16078,14 +20105,13 @@ ArgumentParser::separate_arg_abbrev(
         ParserInfo const& info,
         std::vector<std::string>& temp,
         std::string const& arg,
-        std::string const& name,
-        pArguments const& args) const
+        std::string const& name) const
 {
     if (name.size() + 1 == arg.size()) {
         std::vector<std::string> const split
                 = detail::_split_equal(arg, info.parser->prefix_chars());
         if (split.size() == 2 && !split.front().empty()
-                && detail::_find_arg_by_flag(info.optional, split.front())) {
+                && info.flags->find(info.flags->optional, split.front())) {
             temp.push_back(arg);
             return;
         }
@@ -16099,7 +20125,7 @@ ArgumentParser::separate_arg_abbrev(
                 cp_size = 1;
             }
             if (!detail::_process_separate_arg_abbrev(
-                        name, i, cp_size, flags, arg, args)) {
+                        name, i, cp_size, flags, arg, info.flags->optional)) {
                 break;
             }
             i += cp_size;
@@ -16112,7 +20138,7 @@ ArgumentParser::separate_arg_abbrev(
 
 ARGPARSE_INL void
 ArgumentParser::process_positional_args(
-        std::vector<std::string> const& parsed_arguments,
+        std::vector<detail::token> const& parsed_arguments,
         std::size_t& i,
         Parsers& parsers,
         bool was_pseudo_arg,
@@ -16122,23 +20148,25 @@ ArgumentParser::process_positional_args(
         pArguments& positional,
         std::vector<std::string>& unrecognized_args) const
 {
+    // the positional values are stored, so they are copied here
+    std::size_t const first = i;
     std::list<std::string> args;
-    args.push_back(parsed_arguments.at(i));
+    args.push_back(detail::_token_str(parsed_arguments.at(i)));
     bool remainder = pos < positional.size()
             && positional.at(pos)->m_nargs == detail::REMAINDING;
     while (true) {
         if (++i == parsed_arguments.size()) {
             break;
         } else {
-            std::string const& next = parsed_arguments.at(i);
-            if (remainder || (detail::_is_not_operand(
-                                  was_pseudo_arg, parsers.back().operand, next)
+            detail::token const& next = parsed_arguments.at(i);
+            if (remainder || (is_not_operand(
+                                  was_pseudo_arg, parsers.back(), next)
                               && detail::_not_optional(
                                   next,
                                   parsers.back().parser->prefix_chars(),
                                   parsers.back().has_negative_args,
                                   was_pseudo_arg))) {
-                args.push_back(next);
+                args.push_back(detail::_token_str(next));
             } else {
                 --i;
                 break;
@@ -16148,6 +20176,9 @@ ArgumentParser::process_positional_args(
     if (intermixed) {
         detail::_insert_to_end(args, intermixed_args);
     } else {
+        // the values are taken in order, so the failed value is known
+        ParserInfo& current = parsers.back();
+        current.values_index = first;
         if (parsers.back().subparsers.first) {
             if (try_capture_parser(parsers, pos, positional, unrecognized_args,
                                    args, i == parsed_arguments.size())) {
@@ -16158,6 +20189,7 @@ ArgumentParser::process_positional_args(
             match_args_partial(parsers, pos, positional, unrecognized_args,
                                args, i == parsed_arguments.size());
         }
+        current.values_index = std::string::npos;
     }
 }
 
@@ -16168,26 +20200,35 @@ ArgumentParser::check_mutex_groups(
     for (Parsers::const_iterator i = parsers.begin(); i != parsers.end(); ++i) {
         for (mtx_it j = (*i).parser->m_mutex_groups.begin();
              j != (*i).parser->m_mutex_groups.end(); ++j) {
-            std::string args;
-            std::string found;
+            // the flags are joined for the error message only
+            Argument const* found = ARGPARSE_NULLPTR;
             for (arg_iterator k = (*j).m_data->m_arguments.begin();
                  k != (*j).m_data->m_arguments.end(); ++k) {
-                std::string flags = detail::_join((*k)->flags(), "/");
-                args += detail::_spaces + flags;
-                if (!parsers.front().storage.at(*k).empty()) {
-                    if (!found.empty()) {
-                        (*i).parser->throw_error("argument " + flags + ": not "
-                                            + "allowed with argument " + found);
+                if (!parsers.front().storage.value().at(*k).empty()) {
+                    if (found) {
+                        report_error(*i, ParseResult::NotAllowedArguments,
+                                     "argument "
+                                     + detail::_join((*k)->flags(), "/")
+                                     + ": not allowed with argument "
+                                     + detail::_join(found->flags(), "/"),
+                                     (*k).get());
+                        return;
                     }
-                    found = ARGPARSE_MOVE(flags);
+                    found = (*k).get();
                 }
             }
-            if ((*j).required() && found.empty()) {
+            if ((*j).required() && !found) {
                 if ((*j).m_data->m_arguments.empty()) {
                     throw IndexError("list index out of range");
                 }
-                (*i).parser->throw_error(
-                            "one of the arguments" + args + " is required");
+                std::string args;
+                for (arg_iterator k = (*j).m_data->m_arguments.begin();
+                     k != (*j).m_data->m_arguments.end(); ++k) {
+                    args += detail::_spaces + detail::_join((*k)->flags(), "/");
+                }
+                report_error(*i, ParseResult::RequiredArguments,
+                             "one of the arguments" + args + " is required");
+                return;
             }
         }
     }
@@ -16229,11 +20270,11 @@ ArgumentParser::process_required_check(
         _Storage const& storage)
 {
     std::vector<std::string> required;
-    process_required_arguments(required, info.optional, storage);
-    process_required_arguments(required, info.operand, storage);
+    process_required_arguments(required, *info.required, storage);
     if (!required.empty()) {
-        info.parser->throw_error("the following arguments are required: "
-                                 + detail::_join(required, ", "));
+        report_error(info, ParseResult::RequiredArguments,
+                     "the following arguments are required: "
+                     + detail::_join(required, ", "));
     }
 }
 
@@ -16265,12 +20306,13 @@ ARGPARSE_INL void
 ArgumentParser::check_required_args(
         Parsers& parsers,
         std::size_t& pos,
-        pArguments const& positional) const
+        pArguments const& positional,
+        bool update) const
 {
     std::list<ParserInfo>::reverse_iterator it = parsers.rbegin();
     std::vector<std::string> required;
-    process_required_arguments(required, it->optional, parsers.front().storage);
-    process_required_arguments(required, it->operand, parsers.front().storage);
+    process_required_arguments(required, *it->required,
+                               parsers.front().storage.value());
     SubParsersInfo const& info = it->subparsers;
     bool sub_required = info.first && info.first->required();
     if (!required.empty() || pos < positional.size() || sub_required) {
@@ -16278,6 +20320,10 @@ ArgumentParser::check_required_args(
         for ( ; pos < positional.size(); ++pos) {
             process_required_subparsers(sub_required, pos, info, args);
             pArgument const& arg = positional.at(pos);
+            if (update && parsers.front().storage.value().at(arg).is_parsed()) {
+                // the value of the updated namespace is kept
+                continue;
+            }
             if (args.empty() && skip_positional_required_check(parsers, arg)) {
                 continue;
             }
@@ -16288,22 +20334,25 @@ ArgumentParser::check_required_args(
             detail::_append_value_to(required.at(i), args, ", ");
         }
         if (!args.empty()) {
-            it->parser->throw_error(
-                        "the following arguments are required: " + args);
+            report_error(*it, ParseResult::RequiredArguments,
+                         "the following arguments are required: " + args);
+            return;
         }
     }
-    while (++it != parsers.rend()) {
-        process_required_check(*it, parsers.front().storage);
+    while (++it != parsers.rend() && !parsers.front().failed()) {
+        process_required_check(*it, parsers.front().storage.value());
     }
 }
 
 ARGPARSE_INL void
 ArgumentParser::check_unrecognized_args(
+        ParserInfo const& info,
         bool only_known,
         std::vector<std::string> const& args) const
 {
     if (!only_known && !args.empty()) {
-        throw_error("unrecognized arguments: " + detail::_join(args));
+        report_error(info, ParseResult::UnrecognizedArguments,
+                     "unrecognized arguments: " + detail::_join(args));
     }
 }
 
@@ -16344,30 +20393,98 @@ ArgumentParser::default_values_post_trigger(
     }
 }
 
+ARGPARSE_INL void
+ArgumentParser::suppressed_post_trigger(
+        detail::CowValue<_Storage>& storage,
+        pArguments const& suppressed)
+{
+    for (std::size_t i = 0; i < suppressed.size(); ++i) {
+        _Storage& data = storage.data();
+        _Storage::iterator it = data.find(suppressed.at(i));
+        if (it != data.end() && !it->second.exists()) {
+            data.erase(it);
+        }
+    }
+}
+
+ARGPARSE_INL void
+ArgumentParser::bind_value(
+        detail::storage_value const& value)
+{
+    if (value.first->m_binder
+            && (!value.second.empty()
+                || value.first->action() == argparse::count)) {
+        value.first->m_binder->store(value.first->get_dest(), value);
+    }
+}
+
+ARGPARSE_INL void
+ArgumentParser::bind_values(
+        _Storage const& storage)
+{
+    for (_Storage::const_iterator it = storage.begin();
+         it != storage.end(); ++it) {
+        bind_value(*it);
+    }
+}
+
+ARGPARSE_INL void
+ArgumentParser::bind_values(
+        Parsers const& parsers)
+{
+    _Storage const& storage = parsers.front().storage.value();
+    for (Parsers::const_iterator p = parsers.begin(); p != parsers.end(); ++p) {
+        if (!(*p).parser->m_plan) {
+            bind_values(storage);
+            return;
+        }
+    }
+    for (Parsers::const_iterator p = parsers.begin(); p != parsers.end(); ++p) {
+        pArguments const& bound = (*p).parser->m_plan->bound;
+        for (std::size_t i = 0; i < bound.size(); ++i) {
+            _Storage::const_iterator it = storage.find(bound.at(i));
+            if (it != storage.end()) {
+                bind_value(*it);
+            }
+        }
+    }
+}
+
 ARGPARSE_INL void
 ArgumentParser::namespace_post_trigger(
         Parsers& parsers,
         bool only_known,
         std::vector<std::string> const& unrecognized_args)
 {
+    // namespaces share the storage, build its lookup tables before
+    _Storage& storage = parsers.front().storage.data();
+    storage.update_slots();
+    storage.update_names();
     parsers.front().parser->parse_handle(
                 only_known, parsers.front().parser->m_default_func,
                 parsers.front().storage, unrecognized_args);
     pi_iterator p = parsers.begin();
-    _Storage const* storage = &(*p).storage;
     for (++p; p != parsers.end(); ++p) {
-        _Storage& current = (*p).storage;
-        for (_Storage::iterator it = current.begin(); it != current.end(); ) {
-            if (storage->exists(it->first)) {
-                it->second = storage->at(it->first);
-                ++it;
-            } else {
-                it = current.erase(it);
+        if (!(*p).parser->m_parse_handle) {
+            continue;
+        }
+        // subparser namespace has the arguments of the subparser
+        // and its nested subparsers
+        _Storage current;
+        for (pi_iterator q = p; q != parsers.end(); ++q) {
+            pArguments const& arguments = (*q).arguments;
+            for (std::size_t i = 0; i < arguments.size(); ++i) {
+                _Storage::const_iterator it = storage.find(arguments.at(i));
+                if (it != storage.end()) {
+                    current.create(it->first);
+                    current.at(it->first) = it->second;
+                }
             }
         }
-        (*p).parser->parse_handle(only_known, (*p).parser->m_default_func,
-                                  current, unrecognized_args);
-        storage = &(*p).storage;
+        (*p).parser->parse_handle(
+                    only_known, (*p).parser->m_default_func,
+                    detail::CowValue<_Storage>(ARGPARSE_MOVE(current)),
+                    unrecognized_args);
     }
 }
 
@@ -16458,6 +20575,7 @@ ArgumentParser::update_prog(
         std::string const& parent_prog)
 {
     m_prog = parent_prog + detail::_spaces + m_name;
+    m_help_cache.clear();
 }
 
 ARGPARSE_INL void
@@ -16473,7 +20591,7 @@ ARGPARSE_INL void
 ArgumentParser::parse_handle(
         bool only_known,
         detail::func1<Namespace const&>::type const& func,
-        _Storage const& storage,
+        detail::CowValue<_Storage> const& storage,
         std::vector<std::string> const& unrecognized_args) const
 {
     if (m_parse_handle) {
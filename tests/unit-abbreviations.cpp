@@ -157,4 +157,23 @@ TEST_CASE("1. abbreviations", "[argument]")
         CHECK(args5.get<uint32_t>("-c") == 4);
         CHECK(args5.get<bool>("-ccc") == false);
     }
+
+    SECTION("1.7. long flags abbreviations") {
+        parser.add_argument("--foobar").action(argparse::store);
+        parser.add_argument("--bar", "--foo").action(argparse::store);
+        parser.add_argument("--baz").action(argparse::store_true);
+
+        argparse::Namespace args1 = parser.parse_args(_make_vec("--foob", "1"));
+        CHECK(args1.get<std::string>("foobar") == "1");
+        CHECK(args1.get<std::string>("bar") == "");
+
+        argparse::Namespace args2 = parser.parse_args(_make_vec("--bar=2", "--baz"));
+        CHECK(args2.get<std::string>("bar") == "2");
+        CHECK(args2.get<bool>("baz") == true);
+
+        CHECK_THROWS_WITH(parser.parse_args(_make_vec("--fo", "1")),
+                          "untitled: error: ambiguous option: '--fo' could match --foobar, --foo");
+        CHECK_THROWS_WITH(parser.parse_args(_make_vec("--b", "1")),
+                          "untitled: error: ambiguous option: '--b' could match --bar, --baz");
+    }
 }
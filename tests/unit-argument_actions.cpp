@@ -5,6 +5,51 @@
 #define ARGPARSE_DECLARATION
 #include "./argparse_test.hpp"
 
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#ifdef ARGPARSE_CXX_11
+// counts the heap allocations of the test
+static std::size_t _allocations = 0;
+
+void*
+operator new(std::size_t size)
+{
+    ++_allocations;
+    void* res = std::malloc(size != 0 ? size : 1);
+    if (!res) {
+        throw std::bad_alloc();
+    }
+    return res;
+}
+
+void
+operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+#ifdef ARGPARSE_CXX_14
+void
+operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+#endif  // C++14+
+
+static std::size_t
+_parse_allocations(
+        argparse::ArgumentParser const& parser,
+        std::vector<std::string> const& args)
+{
+    std::size_t const before = _allocations;
+    argparse::Namespace const space = parser.parse_args(args);
+    return _allocations - before;
+}
+#endif  // C++11+
+
 TEST_CASE("1. argument actions", "[argument]")
 {
     // with argument_default (store_true, store_false, count) actions are invalid in python
@@ -241,3 +286,90 @@ TEST_CASE("1. argument actions", "[argument]")
         CHECK(parser.parse_args("--arg --no-arg").get<uint32_t>("arg") == 2);
     }
 }
+
+TEST_CASE("2. explicit arguments", "[argument]")
+{
+    argparse::ArgumentParser parser = argparse::ArgumentParser().exit_on_error(false);
+    parser.add_argument("--opt").help("opt help");
+    parser.add_argument("--flag").action(argparse::BooleanOptionalAction).help("flag help");
+    parser.add_argument("out=").required(false).help("out help");
+    parser.add_argument("files").nargs("*").help("files help");
+
+    SECTION("2.1. optional value after '='") {
+        argparse::Namespace args = parser.parse_args(_make_vec("--opt=value", "--opt=a=b"));
+        CHECK(args.get<std::string>("opt") == "a=b");
+        CHECK(parser.parse_args(_make_vec("--opt=")).get<std::string>("opt") == "");
+        CHECK(parser.parse_args(_make_vec("--opt", "=x")).get<std::string>("opt") == "=x");
+    }
+
+    SECTION("2.2. token starting with '='") {
+        argparse::Namespace args = parser.parse_args(_make_vec("=x", "=", "y"));
+        CHECK(args.to_string("files") == "[=x, =, y]");
+        CHECK(args.get<std::string>("opt") == "");
+    }
+
+    SECTION("2.3. BooleanOptionalAction negative flag") {
+        CHECK(parser.parse_args(_make_vec("--flag")).get<bool>("flag") == true);
+        CHECK(parser.parse_args(_make_vec("--no-flag")).get<bool>("flag") == false);
+        REQUIRE_THROWS_WITH(parser.parse_args(_make_vec("--no-flag=1")),
+                            "untitled: error: argument --no-flag: ignored explicit argument '1'");
+    }
+
+    SECTION("2.4. help with explicit argument") {
+        REQUIRE_THROWS_WITH(parser.parse_args(_make_vec("-h=x")),
+                            "untitled: error: argument -h: ignored explicit argument 'x'");
+        REQUIRE_THROWS_WITH(parser.parse_args(_make_vec("--help=")),
+                            "untitled: error: argument --help: ignored explicit argument ''");
+    }
+
+    SECTION("2.5. operand lookahead") {
+        argparse::Namespace args = parser.parse_args(_make_vec("a", "b=x", "out=c"));
+        CHECK(args.get<std::string>("out") == "c");
+        CHECK(args.to_string("files") == "[a, b=x]");
+        REQUIRE_THROWS_WITH(parser.parse_args(_make_vec("a", "out=c", "d")),
+                            "untitled: error: unrecognized arguments: d");
+        CHECK(parser.parse_args(_make_vec("out=", "a")).get<std::string>("out") == "");
+        REQUIRE_THROWS_WITH(parser.parse_args(_make_vec("out")),
+                            "untitled: error: argument out is operand: expected A=...");
+    }
+}
+
+#ifdef ARGPARSE_CXX_11
+TEST_CASE("3. validation allocations", "[argument]")
+{
+    argparse::ArgumentParser parser1 = argparse::ArgumentParser().exit_on_error(false);
+    parser1.add_argument("--a");
+    parser1.add_argument("--b");
+    parser1.add_argument("--c");
+    parser1.add_argument("--d");
+    parser1.add_argument("--e").action("store_true");
+    parser1.add_argument("pos");
+
+    // the same arguments with the mutually exclusive groups and required flags
+    argparse::ArgumentParser parser2 = argparse::ArgumentParser().exit_on_error(false);
+    argparse::MutuallyExclusiveGroup& group1 = parser2.add_mutually_exclusive_group().required(true);
+    group1.add_argument("--a");
+    group1.add_argument("--b");
+    parser2.add_argument("--c").required(true);
+    argparse::MutuallyExclusiveGroup& group2 = parser2.add_mutually_exclusive_group();
+    group2.add_argument("--d");
+    group2.add_argument("--e").action("store_true");
+    parser2.add_argument("pos");
+
+    parser1.freeze();
+    parser2.freeze();
+
+    SECTION("3.1. valid command line") {
+        std::vector<std::string> const args = _make_vec("--a", "1", "--c", "2", "--e", "x");
+        // the checks of the valid command line don't allocate the messages
+        CHECK(_parse_allocations(parser2, args) == _parse_allocations(parser1, args));
+    }
+
+    SECTION("3.2. invalid command line") {
+        REQUIRE_THROWS_WITH(parser2.parse_args(_make_vec("--a", "1", "--b", "2", "--c", "3", "x")),
+                            "untitled: error: argument --b: not allowed with argument --a");
+        REQUIRE_THROWS_WITH(parser2.parse_args(_make_vec("--a", "1", "x")),
+                            "untitled: error: the following arguments are required: --c");
+    }
+}
+#endif  // C++11+
@@ -78,6 +78,36 @@ TEST_CASE("1. argument choices", "[argument]")
         CHECK(args5.get<std::string>("--foo") == "");
         CHECK(args5.get<std::string>("--bar") == "R");
     }
+
+    SECTION("1.4. suggest on error") {
+        parser.suggest_on_error(true);
+        parser.add_argument("--foo").choices(_make_vec("install", "uninstall", "list"));
+        parser.add_argument("--bar").choices(_make_vec("list", "abaabbb"));
+        argparse::ArgumentParser& sub = parser.add_subparsers().dest("cmd").add_parser("build");
+        sub.suggest_on_error(true);
+        sub.add_argument("--baz").choices(_make_vec("release", "debug"));
+
+        for (int frozen = 0; frozen < 2; ++frozen) {
+            if (frozen) {
+                parser.freeze();
+            }
+            CHECK(parser.parse_one("--foo instal").error()
+                  == "untitled: error: argument --foo: invalid choice: 'instal', "
+                     "maybe you meant 'install'? (choose from 'install', 'uninstall', 'list')");
+            CHECK(parser.parse_one("--foo xyz").error()
+                  == "untitled: error: argument --foo: invalid choice: 'xyz' "
+                     "(choose from 'install', 'uninstall', 'list')");
+            CHECK(parser.parse_one("--bar ababbbbab").error()
+                  == "untitled: error: argument --bar: invalid choice: 'ababbbbab', "
+                     "maybe you meant 'abaabbb'? (choose from 'list', 'abaabbb')");
+            CHECK(parser.parse_one("biuld").error()
+                  == "untitled: error: argument {build}: invalid choice: 'biuld', "
+                     "maybe you meant 'build'? (choose from 'build')");
+            CHECK(parser.parse_one("build --baz debgu").error()
+                  == "untitled build: error: argument --baz: invalid choice: 'debgu', "
+                     "maybe you meant 'debug'? (choose from 'release', 'debug')");
+        }
+    }
 }
 
 TEST_CASE("2. argument dest", "[argument]")
@@ -114,6 +144,23 @@ TEST_CASE("2. argument dest", "[argument]")
         CHECK(args2.get<std::string>(dest_bar) == local_default);
         CHECK(args2.get<std::string>("foobar") == "foobar");
     }
+
+    SECTION("2.3. shared dest") {
+        parser.add_argument("--foo").dest(dest_foo);
+        parser.add_argument("--bar").dest(dest_bar);
+        parser.add_argument("--baz").dest(dest_foo);
+        parser.add_argument("--append").action("append").dest(dest_bar);
+
+        argparse::Namespace args1 = parser.parse_args(_make_vec("--foo=foo"));
+        CHECK(args1.get<std::string>(dest_foo) == "foo");
+        CHECK(args1.get<std::string>(dest_bar) == global_default);
+
+        argparse::Namespace args2 = parser.parse_args(_make_vec("--foo=foo", "--baz=baz"));
+        CHECK(args2.get<std::string>(dest_foo) == "baz");
+
+        argparse::Namespace args3 = parser.parse_args(_make_vec("--append=1", "--append=2", "--bar=3"));
+        CHECK(args3.get<std::string>(dest_bar) == "3");
+    }
 }
 
 TEST_CASE("3. argument const", "[argument]")
@@ -186,3 +233,64 @@ TEST_CASE("3. argument const", "[argument]")
                             argparse::Argument("foo7?").action("extend").nargs("?").const_value(const_value)));
     }
 }
+
+TEST_CASE("4. argument type", "[argument]")
+{
+    argparse::ArgumentParser parser = argparse::ArgumentParser().exit_on_error(false);
+
+    SECTION("4.1. parse time conversion") {
+        parser.add_argument("--foo").type<int>().default_value("5");
+        parser.add_argument("--bar").type<std::vector<double> >().nargs("+");
+        parser.add_argument("--baz").type<uint16_t>().action("append");
+        parser.add_argument("pos").type<int64_t>().nargs("?");
+
+        argparse::Namespace args1 = parser.parse_args(_make_vec());
+        CHECK(args1.get<int>("foo") == 5);
+        CHECK(args1.get<std::vector<double> >("bar").empty());
+        CHECK(args1.get<int64_t>("pos") == 0);
+
+        argparse::Namespace args2 = parser.parse_args(
+                    _make_vec("--foo=-3", "--bar", "1.5", "-.5", "--baz=1", "--baz", "2", "--", "-7"));
+        CHECK(args2.get<int>("foo") == -3);
+        CHECK(args2.get<long>("foo") == -3);
+        CHECK(args2.to_string("foo") == "-3");
+        CHECK(args2.get<std::vector<double> >("bar").size() == 2);
+        CHECK(args2.get<std::vector<double> >("bar").at(1) == -0.5);
+        CHECK(args2.get<std::vector<float> >("bar").at(0) == 1.5f);
+        CHECK(args2.get<std::vector<uint16_t> >("baz").at(1) == 2);
+        CHECK(args2.get<int64_t>("pos") == -7);
+#ifdef ARGPARSE_HAS_OPTIONAL
+        CHECK(args2.try_get<int>("foo").value() == -3);
+        CHECK(args2.try_get<std::vector<double> >("bar").value().at(0) == 1.5);
+        CHECK(!args2.try_get<std::string>("bar").has_value());
+#endif  // ARGPARSE_HAS_OPTIONAL
+
+        argparse::Namespace args3 = parser.parse_args(_make_vec("--foo", "1", "--foo", "2"));
+        CHECK(args3.get<int>("foo") == 2);
+    }
+
+    SECTION("4.2. invalid values") {
+        parser.add_argument("--foo").type<int>();
+        parser.add_argument("--bar").type<std::vector<double> >().nargs(2);
+        parser.add_argument("--baz").type<uint8_t>();
+
+        CHECK_THROWS_WITH(parser.parse_args(_make_vec("--foo", "abc")),
+                          "untitled: error: argument --foo: invalid int value: 'abc'");
+        CHECK_THROWS_WITH(parser.parse_args(_make_vec("--foo=99999999999")),
+                          "untitled: error: argument --foo: invalid int value: '99999999999'");
+        CHECK_THROWS_WITH(parser.parse_args(_make_vec("--bar", "1", "x")),
+                          "untitled: error: argument --bar: invalid float value: 'x'");
+        CHECK_NOTHROW(parser.parse_args(_make_vec("--foo", "", "--baz", "z")));
+    }
+
+    SECTION("4.3. default values are converted on demand") {
+        parser.add_argument("--foo").type<int>().default_value("abc");
+        parser.add_argument("--bar").type("int");
+
+        argparse::Namespace args = parser.parse_args(_make_vec("--bar", "abc"));
+        CHECK(args.to_string("foo") == "abc");
+        CHECK_THROWS(args.get<int>("foo"));
+        CHECK(args.to_string("bar") == "abc");
+        CHECK_THROWS(args.get<int>("bar"));
+    }
+}
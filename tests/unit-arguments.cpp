@@ -303,3 +303,72 @@ TEST_CASE("5. operand arguments", "[argument_parser]")
         CHECK(args.get<std::string>("bar") == bar);
     }
 }
+
+TEST_CASE("6. flag lookup", "[argument_parser]")
+{
+    argparse::ArgumentParser parser = argparse::ArgumentParser().add_help(false).exit_on_error(false);
+    for (char c = 'a'; c <= 'z'; ++c) {
+        std::string name = std::string(1, c) + std::string(1, c);
+        parser.add_argument("-" + std::string(1, c), "--" + name);
+    }
+    argparse::MutuallyExclusiveGroup& group = parser.add_mutually_exclusive_group();
+    group.add_argument("--mutex");
+    parser.add_argument("key=").required(false);
+
+    SECTION("6.1. short and long flags") {
+        argparse::Namespace args = parser.parse_args(_make_vec("-a", "1", "--zz", "26", "--mm=13"));
+        CHECK(args.get<std::string>("aa") == "1");
+        CHECK(args.get<std::string>("zz") == "26");
+        CHECK(args.get<std::string>("mm") == "13");
+        CHECK(args.get<std::string>("bb") == "");
+    }
+
+    SECTION("6.2. mutually exclusive group flags") {
+        argparse::Namespace args = parser.parse_args(_make_vec("--mutex", "value", "-y", "25"));
+        CHECK(args.get<std::string>("mutex") == "value");
+        CHECK(args.get<std::string>("yy") == "25");
+    }
+
+    SECTION("6.3. operand flags") {
+        argparse::Namespace args = parser.parse_args(_make_vec("key=value", "-k", "v"));
+        CHECK(args.get<std::string>("key") == "value");
+        CHECK(args.get<std::string>("kk") == "v");
+
+        CHECK_THROWS(parser.parse_args(_make_vec("-k", "key=value")));
+    }
+}
+
+TEST_CASE("7. main function arguments", "[argument_parser]")
+{
+    argparse::ArgumentParser parser = argparse::ArgumentParser().exit_on_error(false);
+    parser.add_argument("-a").action("store_true");
+    parser.add_argument("-b").action("store_true");
+    parser.add_argument("--foo");
+    parser.add_argument("bar").nargs("+");
+
+    SECTION("7.1. parse arguments") {
+        char const* argv[] = { "prog", "-ab", "--foo=1", "x", "y", NULL };
+        int argc = 5;
+
+        argparse::Namespace args = parser.parse_args(argc, argv);
+        CHECK(args.get<bool>("a") == true);
+        CHECK(args.get<bool>("b") == true);
+        CHECK(args.get<std::string>("foo") == "1");
+        CHECK(args.get<std::vector<std::string> >("bar").size() == 2);
+        CHECK(args.get<std::vector<std::string> >("bar").at(1) == "y");
+
+        argc = 1;
+        CHECK_THROWS(parser.parse_args(argc, argv));
+    }
+
+    SECTION("7.2. parse known arguments") {
+        char const* argv[] = { "prog", "z", "--baz", "-a", NULL };
+        int argc = 4;
+
+        argparse::Namespace args = parser.parse_known_args(argc, argv);
+        CHECK(args.get<bool>("a") == true);
+        CHECK(args.get<std::string>("bar") == "z");
+        CHECK(args.unrecognized_args().size() == 1);
+        CHECK(args.unrecognized_args().front() == "--baz");
+    }
+}
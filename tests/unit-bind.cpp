@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Golubchikov Mihail <https://github.com/rue-ryuzaki>
+ */
+
+#define ARGPARSE_DECLARATION
+#include "./argparse_test.hpp"
+
+#include <set>
+#include <string>
+#include <vector>
+
+TEST_CASE("1. bind to variables", "[argument]")
+{
+    argparse::ArgumentParser parser = argparse::ArgumentParser().exit_on_error(false);
+
+    SECTION("1.1. actions") {
+        int foo = -1;
+        std::string bar = "init";
+        bool flag = false;
+        uint32_t verbose = 0;
+        std::vector<double> values;
+        std::set<std::string> names;
+        std::vector<int> ext;
+
+        parser.add_argument("--foo").bind(foo);
+        parser.add_argument("--bar").bind(bar);
+        parser.add_argument("--flag").action("store_true").bind(flag);
+        parser.add_argument("-v").action("count").bind(verbose);
+        parser.add_argument("--value").action("append").bind(values);
+        parser.add_argument("--name").action("append").bind(names);
+        parser.add_argument("--ext").action("extend").nargs("+").bind(ext);
+
+        argparse::Namespace args1 = parser.parse_args(_make_vec());
+        CHECK(foo == -1);
+        CHECK(bar == "init");
+        CHECK(flag == false);
+        CHECK(verbose == 0);
+        CHECK(values.empty());
+        CHECK(names.empty());
+        CHECK(ext.empty());
+
+        argparse::Namespace args2 = parser.parse_args(
+                    "--foo=3 --bar b --flag -vvv --value 1.5 --value=2 "
+                    "--name b --name a --name b --ext 1 2 --ext 3");
+        CHECK(foo == 3);
+        CHECK(bar == "b");
+        CHECK(flag == true);
+        CHECK(verbose == 3);
+        CHECK(values.size() == 2);
+        CHECK(values.at(1) == 2.0);
+        CHECK(names.size() == 2);
+        CHECK(*names.begin() == "a");
+        CHECK(ext.size() == 3);
+        CHECK(ext.at(2) == 3);
+        CHECK(args2.get<int>("foo") == foo);
+    }
+
+    SECTION("1.2. default values") {
+        int foo = 0;
+        std::pair<std::string, int> bar;
+
+        parser.add_argument("--foo").default_value("5").bind(foo);
+        parser.add_argument("--bar").bind(bar);
+
+        parser.parse_args(_make_vec("--bar", "key=2"));
+        CHECK(foo == 5);
+        CHECK(bar.first == "key");
+        CHECK(bar.second == 2);
+    }
+
+    SECTION("1.3. invalid values") {
+        int foo = 1;
+
+        parser.add_argument("--foo").bind(foo);
+
+        CHECK_THROWS_WITH(parser.parse_args(_make_vec("--foo", "abc")),
+                          "untitled: error: argument --foo: invalid int value: 'abc'");
+        CHECK(foo == 1);
+    }
+
+    SECTION("1.4. subparsers") {
+        int foo = 0;
+        std::string bar;
+
+        parser.add_argument("--foo").bind(foo);
+        argparse::ArgumentParser& sub = parser.add_subparsers().add_parser("sub");
+        sub.add_argument("bar").bind(bar);
+        parser.freeze();
+
+        parser.parse_args(_make_vec("--foo", "1", "sub", "value"));
+        CHECK(foo == 1);
+        CHECK(bar == "value");
+    }
+
+    SECTION("1.5. parse results") {
+        int foo = 0;
+
+        parser.add_argument("--foo").bind(foo);
+
+        argparse::ParseResult res = parser.parse_one("--foo 2");
+        CHECK(res.value().get<int>("foo") == 2);
+        CHECK(foo == 0);
+
+        std::vector<std::string> command_lines;
+        command_lines.push_back("--foo 3");
+        command_lines.push_back("--foo 4");
+        std::vector<argparse::ParseResult> results = parser.parse_many(command_lines, 2);
+        CHECK(results.at(1).value().get<int>("foo") == 4);
+        CHECK(foo == 0);
+
+        parser.parse_args(_make_vec("--foo", "5"));
+        CHECK(foo == 5);
+    }
+}
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2026 Golubchikov Mihail <https://github.com/rue-ryuzaki>
+ */
+
+#define ARGPARSE_DECLARATION
+#include "./argparse_test.hpp"
+
+#ifdef ARGPARSE_CXX_11
+#include <atomic>
+#include <thread>
+#endif  // C++11+
+
+#include <cstdio>
+#include <fstream>
+
+#include <string>
+#include <vector>
+
+TEST_CASE("1. freeze", "[argument_parser]")
+{
+    argparse::ArgumentParser parser = argparse::ArgumentParser().exit_on_error(false);
+
+    SECTION("1.1. frozen parser") {
+        parser.add_argument("--foo").help("foo help");
+        parser.add_argument("--foobar").action("store_true").help("foobar help");
+        parser.add_argument("--req").required(true).help("req help");
+        parser.add_argument("bar").help("bar help");
+
+        CHECK(parser.frozen() == false);
+        parser.freeze();
+        CHECK(parser.frozen() == true);
+
+        for (int i = 0; i < 2; ++i) {
+            argparse::Namespace args = parser.parse_args("--foo 1 --req 2 3 --foob");
+            CHECK(args.get<std::string>("foo") == "1");
+            CHECK(args.get<std::string>("req") == "2");
+            CHECK(args.get<std::string>("bar") == "3");
+            CHECK(args.get<bool>("foobar") == true);
+        }
+        argparse::Namespace args = parser.parse_args("--req 2 3");
+        CHECK(args.get<std::string>("foo") == "");
+        CHECK(args.get<bool>("foobar") == false);
+
+        CHECK_THROWS(parser.parse_args("3"));
+        CHECK_THROWS(parser.parse_args("--fo 1 --req 2 3"));
+        CHECK(parser.frozen() == true);
+    }
+
+    SECTION("1.2. add argument after freeze") {
+        parser.add_argument("--foo").help("foo help");
+        parser.freeze();
+
+        parser.add_argument("--bar").help("bar help");
+        CHECK(parser.frozen() == false);
+
+        argparse::Namespace args = parser.parse_args("--foo 1 --bar 2");
+        CHECK(args.get<std::string>("foo") == "1");
+        CHECK(args.get<std::string>("bar") == "2");
+
+        argparse::MutuallyExclusiveGroup& group = parser.freeze().add_mutually_exclusive_group();
+        CHECK(parser.frozen() == false);
+        group.add_argument("--baz").help("baz help");
+        group.add_argument("--qux").help("qux help");
+        parser.freeze();
+
+        CHECK_THROWS(parser.parse_args("--baz 1 --qux 2"));
+        args = parser.parse_args("--baz 3");
+        CHECK(args.get<std::string>("baz") == "3");
+        CHECK(args.get<std::string>("qux") == "");
+    }
+
+    SECTION("1.3. frozen subparsers") {
+        parser.add_argument("--foo").action("store_true").help("foo help");
+
+        argparse::SubParsers& subparsers = parser.add_subparsers().dest("cmd");
+        argparse::ArgumentParser& parser_a = subparsers.add_parser("a");
+        parser_a.add_argument("bar").help("bar help");
+        argparse::ArgumentParser& parser_b = subparsers.add_parser("b");
+        parser_b.add_argument("--baz").help("baz help");
+
+        parser.freeze();
+        CHECK(parser_a.frozen() == true);
+        CHECK(parser_b.frozen() == true);
+
+        argparse::Namespace args1 = parser.parse_args("--foo a 1");
+        CHECK(args1.get<bool>("foo") == true);
+        CHECK(args1.get<std::string>("cmd") == "a");
+        CHECK(args1.get<std::string>("bar") == "1");
+
+        argparse::Namespace args2 = parser.parse_args("b --baz 2");
+        CHECK(args2.get<bool>("foo") == false);
+        CHECK(args2.get<std::string>("cmd") == "b");
+        CHECK(args2.get<std::string>("baz") == "2");
+
+        CHECK_THROWS(parser.parse_args("a"));
+    }
+
+    SECTION("1.4. frozen parser help") {
+        parser.prog("prog").output_width(80);
+        parser.add_argument("--foo").help("foo help");
+
+        std::string const help = parser.format_help();
+        parser.freeze();
+        CHECK(parser.format_help() == help);
+        CHECK(parser.format_help() == help);
+        CHECK(parser.format_usage() == "usage: prog [-h] [--foo FOO]");
+
+        parser.description("description");
+        CHECK(parser.frozen() == true);
+        CHECK(parser.format_help() != help);
+        CHECK(parser.format_help().find("\ndescription\n") != std::string::npos);
+
+        parser.usage("prog [options]");
+        CHECK(parser.format_usage() == "usage: prog [options]");
+
+        parser.output_width(40);
+        parser.epilog("epilog text that is long enough to be wrapped by the output width");
+        CHECK(parser.format_help().find("epilog text that is long enough to be\nwrapped") != std::string::npos);
+
+        parser.add_argument("--bar").help("bar help");
+        CHECK(parser.frozen() == false);
+        CHECK(parser.freeze().format_help().find("--bar BAR") != std::string::npos);
+    }
+
+    SECTION("1.5. frozen parser choices") {
+        std::vector<std::string> choices;
+        for (std::size_t i = 0; i < 1000; ++i) {
+            choices.push_back("zone-" + argparse::detail::_to_string(1000 - i));
+        }
+        parser.add_argument("--zone").choices(choices).nargs("+");
+        parser.add_argument("cmd").choices(_make_vec("start", "stop"));
+        parser.freeze();
+
+        argparse::Namespace args = parser.parse_args("--zone zone-1 zone-1000 zone-500 -- stop");
+        std::vector<std::string> const zones = args.get<std::vector<std::string> >("zone");
+        REQUIRE(zones.size() == 3);
+        CHECK(zones.at(0) == "zone-1");
+        CHECK(zones.at(1) == "zone-1000");
+        CHECK(zones.at(2) == "zone-500");
+        CHECK(args.get<std::string>("cmd") == "stop");
+
+        argparse::ParseResult res = parser.parse_one("--zone zone-1 zone-0 -- start");
+        CHECK(res.error_code() == argparse::ParseResult::InvalidChoice);
+        CHECK(res.error_argument().name() == "zone");
+        CHECK(res.error().find("invalid choice: 'zone-0' (choose from 'zone-1000', 'zone-999', ") != std::string::npos);
+
+        res = parser.parse_one("--zone zone-1 -- restart");
+        CHECK(res.error_code() == argparse::ParseResult::InvalidChoice);
+        CHECK(res.error() == "untitled: error: argument cmd: invalid choice: 'restart' (choose from 'start', 'stop')");
+    }
+
+    SECTION("1.6. frozen parser help defaults") {
+        parser.formatter_class(argparse::ArgumentDefaultsHelpFormatter);
+        parser.add_argument("--foo").default_value("1").help("foo help");
+        parser.freeze();
+        CHECK(parser.format_help().find("foo help (default: 1)") != std::string::npos);
+
+        std::vector<std::pair<std::string, std::string> > values;
+        values.push_back(std::make_pair("foo", "2"));
+        parser.set_defaults(values);
+        CHECK(parser.frozen() == true);
+        CHECK(parser.format_help().find("foo help (default: 2)") != std::string::npos);
+        CHECK(parser.parse_args(_make_vec()).get<std::string>("foo") == "2");
+    }
+}
+
+#ifdef ARGPARSE_CXX_11
+static void
+_parse_concurrently(
+        argparse::ArgumentParser const& parser,
+        std::atomic<std::size_t>& failures)
+{
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < 8; ++t) {
+        threads.emplace_back([&parser, &failures, t] ()
+        {
+            for (std::size_t i = 0; i < 100; ++i) {
+                std::string value = std::to_string(t * 100 + i);
+                try {
+                    argparse::Namespace args = parser.parse_args(
+                                "--foo " + value + " --ba " + value
+                                + (parser.fromfile_prefix_chars().empty()
+                                   ? " -vv" : " @unit-freeze.args")
+                                + " a " + value);
+                    if (args.get<std::string>("foo") != value
+                            || args.get<std::vector<std::string> >("bar")
+                               != std::vector<std::string>{ value }
+                            || args.get<std::size_t>("verbose") != 2
+                            || args.get<std::string>("cmd") != "a"
+                            || args.get<std::string>("baz") != value) {
+                        ++failures;
+                    }
+                    if (i % 10 == 0) {
+                        parser.parse_args("--foo " + value + " b --qux 1");
+                        ++failures;
+                    }
+                } catch (std::exception const&) {
+                }
+            }
+        });
+    }
+    for (std::size_t t = 0; t < threads.size(); ++t) {
+        threads[t].join();
+    }
+}
+
+TEST_CASE("2. concurrent parsing", "[argument_parser]")
+{
+    argparse::ArgumentParser parser = argparse::ArgumentParser().exit_on_error(false);
+    parser.add_argument("--foo").required(true).help("foo help");
+    parser.add_argument("--bar").action("append").help("bar help");
+    parser.add_argument("-v", "--verbose").action("count").help("verbose help");
+
+    argparse::SubParsers& subparsers = parser.add_subparsers().dest("cmd");
+    subparsers.add_parser("a").add_argument("baz").help("baz help");
+    subparsers.add_parser("b").add_argument("--qux").choices("23").help("qux help");
+
+    std::atomic<std::size_t> failures(0);
+
+    SECTION("2.1. frozen parser") {
+        parser.freeze();
+        _parse_concurrently(parser, failures);
+        CHECK(failures == 0);
+    }
+
+    SECTION("2.2. not frozen parser") {
+        _parse_concurrently(parser, failures);
+        CHECK(failures == 0);
+    }
+
+    SECTION("2.3. fromfile arguments") {
+        std::ofstream("unit-freeze.args") << "-v\n-v\n";
+        parser.fromfile_prefix_chars("@").freeze();
+        _parse_concurrently(parser, failures);
+        CHECK(failures == 0);
+        std::remove("unit-freeze.args");
+    }
+
+    SECTION("2.4. subparser flag conflicts") {
+        argparse::ArgumentParser parser2 = argparse::ArgumentParser().exit_on_error(false);
+        parser2.add_argument("-v").action("store_true").help("parent help");
+        parser2.add_subparsers().dest("cmd").add_parser("sub")
+                .add_argument("-v").action("store_true").help("sub help");
+
+        std::vector<std::string> command_lines;
+        for (std::size_t i = 0; i < 100; ++i) {
+            command_lines.push_back("sub -v");
+            command_lines.push_back("-v sub");
+        }
+        std::vector<argparse::ParseResult> res = parser2.parse_many(command_lines, 8);
+        REQUIRE(res.size() == command_lines.size());
+        for (std::size_t i = 0; i < res.size(); ++i) {
+            REQUIRE(res.at(i).has_value());
+            CHECK(res.at(i).value().get<bool>("v") == (i % 2 == 0));
+            CHECK(res.at(i).value().get<bool>("-v") == (i % 2 == 0));
+        }
+        CHECK(parser2.format_help().find("-v          parent help") != std::string::npos);
+    }
+}
+#endif  // C++11+
@@ -1079,3 +1079,256 @@ TEST_CASE("4. value types check", "[namespace]")
 #endif  // ARGPARSE_HAS_SPAN
     }
 }
+
+TEST_CASE("5. arguments lookup", "[namespace]")
+{
+    argparse::ArgumentParser parser = argparse::ArgumentParser().exit_on_error(false);
+
+    parser.add_argument("--foo", "-f").help("foo help");
+    parser.add_argument("--bar").default_value(argparse::SUPPRESS).help("bar help");
+    parser.add_argument("--baz").help("baz help");
+    parser.add_argument("pos").nargs("?").help("pos help");
+
+    SECTION("5.1. lookup by names") {
+        argparse::Namespace args = parser.parse_args("-f 1 --baz 2 3");
+        CHECK(args.get<std::string>("foo") == "1");
+        CHECK(args.get<std::string>("--baz") == "2");
+        CHECK(args.get<std::string>("baz") == "2");
+        CHECK(args.get<std::string>("pos") == "3");
+        CHECK(args.exists("foo"));
+        CHECK(args.exists("pos"));
+        CHECK(!args.exists("bar"));
+        CHECK(!args.exists("--qux"));
+        CHECK(!args.exists("p"));
+        CHECK_THROWS(args.get<std::string>("bar"));
+    }
+
+    SECTION("5.2. lookup after suppressed arguments") {
+        argparse::Namespace args = parser.parse_args("--bar 1 --foo 2");
+        CHECK(args.get<std::string>("bar") == "1");
+        CHECK(args.get<std::string>("-f") == "2");
+        CHECK(args.get<std::string>("baz") == "");
+        CHECK(args.get<std::string>("pos") == "");
+    }
+
+    SECTION("5.3. lookup by keys") {
+        argparse::ArgumentKey const foo = parser.key("-f");
+        argparse::ArgumentKey const bar = parser.key("bar");
+        argparse::ArgumentKey const pos = parser.key("pos");
+        CHECK(foo.name() == "-f");
+        CHECK_THROWS(parser.key("--qux"));
+
+        argparse::Namespace args1 = parser.parse_args("-f 1 --baz 2 3");
+        CHECK(args1.get<std::string>(foo) == "1");
+        CHECK(args1.get<int>(pos) == 3);
+        CHECK(args1.contains(foo));
+        CHECK(args1.exists(pos));
+        CHECK(!args1.contains(bar));
+        CHECK_THROWS(args1.get<std::string>(bar));
+        CHECK_THROWS(args1.get<std::string>(argparse::ArgumentKey()));
+#ifdef ARGPARSE_HAS_OPTIONAL
+        CHECK(args1.try_get<int>(foo).value() == 1);
+        CHECK(!args1.try_get<std::string>(bar).has_value());
+        CHECK(args1.try_get<std::pair<std::string, std::string> >(pos, ':').value().first == "3");
+#endif  // ARGPARSE_HAS_OPTIONAL
+
+        parser.add_argument("--qux").default_value("4");
+        argparse::ArgumentKey const qux = parser.key("qux");
+        parser.freeze();
+
+        argparse::Namespace args2 = parser.parse_args("--bar 1 --foo 2");
+        CHECK(args2.get<std::string>(bar) == "1");
+        CHECK(args2.get<std::string>(foo) == "2");
+        CHECK(args2.get<std::string>(qux) == "4");
+        CHECK(args2.get<std::string>(parser.key("--baz")) == "");
+        CHECK(args2.get<std::string>(pos) == "");
+    }
+
+    SECTION("5.4. subparser keys") {
+        argparse::ArgumentParser& sub = parser.add_subparsers().add_parser("sub");
+        sub.add_argument("--qux");
+        argparse::ArgumentKey const qux = sub.key("qux");
+
+        argparse::Namespace args = parser.parse_args("-f 1 sub --qux 2");
+        CHECK(args.get<std::string>(qux) == "2");
+        CHECK(args.get<std::string>(parser.key("foo")) == "1");
+    }
+
+    SECTION("5.5. rename after parse") {
+        argparse::ArgumentParser parser2 = argparse::ArgumentParser().exit_on_error(false);
+        argparse::Argument& foo = parser2.add_argument("--foo");
+
+        argparse::Namespace const args1 = parser2.parse_args("--foo 1");
+        argparse::Namespace const args2 = args1;
+        CHECK(args1.get<std::string>("foo") == "1");
+        foo.dest("bar");
+
+        CHECK(args1.get<std::string>("bar") == "1");
+        CHECK(args1.exists("bar"));
+        CHECK(!args1.exists("foo"));
+        CHECK(args2.exists("bar"));
+        CHECK(args2.get<std::string>("bar") == "1");
+        CHECK(args1.to_string() == "Namespace(bar='1')");
+    }
+}
+
+TEST_CASE("6. values view", "[namespace]")
+{
+    argparse::ArgumentParser parser = argparse::ArgumentParser().exit_on_error(false);
+    parser.add_argument("--file").action("extend").nargs("+");
+    parser.add_argument("--name").default_value("foo");
+    parser.add_argument("-v").action("count");
+    parser.add_argument("--pair").action("append").nargs(2);
+
+    SECTION("6.1. values view") {
+        argparse::Namespace const args = parser.parse_args("--file a b --file c -vv");
+
+        std::vector<std::string> const& files = args.values_view("file");
+        REQUIRE(files.size() == 3);
+        CHECK(files.at(0) == "a");
+        CHECK(files.at(2) == "c");
+        CHECK(&args.values_view("--file") == &files);
+        CHECK(&args.values_view(parser.key("file")) == &files);
+        CHECK(args.values_view("name").size() == 1);
+        CHECK(args.values_view("name").front() == "foo");
+        CHECK_THROWS(args.values_view("v"));
+        CHECK_THROWS(args.values_view("--bar"));
+    }
+
+#ifdef ARGPARSE_HAS_STRING_VIEW
+    SECTION("6.2. string_view values") {
+        argparse::Namespace const args = parser.parse_args("--file a b --file c --name bar");
+
+        std::vector<std::string> const& files = args.values_view("file");
+        std::string_view const name = args.get<std::string_view>("name");
+        CHECK(name == "bar");
+        CHECK(name.data() == args.values_view("name").front().data());
+
+        std::vector<std::string_view> const views = args.get<std::vector<std::string_view> >("file");
+        REQUIRE(views.size() == 3);
+        CHECK(views.at(1) == "b");
+        CHECK(views.at(1).data() == files.at(1).data());
+
+        argparse::Namespace const pairs = parser.parse_args("--pair a b --pair c d");
+        std::vector<std::vector<std::string_view> > const matrix
+                = pairs.get<std::vector<std::vector<std::string_view> > >("pair");
+        REQUIRE(matrix.size() == 2);
+        CHECK(matrix.at(1).at(0) == "c");
+        CHECK(matrix.at(1).at(0).data() == pairs.values_view("pair").at(2).data());
+        CHECK(pairs.try_get<std::vector<std::vector<std::string_view> > >("pair").value().at(0).at(1).data()
+              == pairs.values_view("pair").at(1).data());
+
+        std::vector<std::string_view> const opt_views
+                = args.try_get<std::vector<std::string_view> >("file").value();
+        REQUIRE(opt_views.size() == 3);
+        CHECK(opt_views.at(2).data() == files.at(2).data());
+    }
+#endif  // ARGPARSE_HAS_STRING_VIEW
+}
+
+TEST_CASE("7. namespace copies", "[namespace]")
+{
+    argparse::ArgumentParser parser = argparse::ArgumentParser().exit_on_error(false);
+    parser.add_argument("--foo").action("append");
+    parser.add_argument("--bar");
+
+    SECTION("7.1. copies share parsed values") {
+        argparse::Namespace const args = parser.parse_args("--foo 1 --foo 2 --bar 3");
+        argparse::Namespace const copy1 = args;
+        argparse::Namespace copy2 = parser.parse_args("");
+        copy2 = copy1;
+
+        CHECK(&copy1.values_view("foo") == &args.values_view("foo"));
+        CHECK(&copy2.values_view("bar") == &args.values_view("bar"));
+        CHECK(copy2.get<std::vector<int> >("foo") == args.get<std::vector<int> >("foo"));
+    }
+
+    SECTION("7.2. parse with namespace") {
+        argparse::Namespace const space = parser.parse_args("--foo 1 --bar 2");
+        argparse::Namespace const args = parser.parse_args("--foo 3", space);
+
+        CHECK(args.to_string("foo") == "[1, 3]");
+        CHECK(args.get<std::string>("bar") == "2");
+        CHECK(space.to_string("foo") == "[1]");
+        CHECK(&args.values_view("bar") != &space.values_view("bar"));
+    }
+
+#ifdef ARGPARSE_CXX_11
+    SECTION("7.3. concurrent lookups in copies") {
+        argparse::Argument& baz = parser.add_argument("--baz");
+        argparse::Namespace const args = parser.parse_args("--baz 1 --bar 2");
+        baz.dest("qux");
+
+        std::atomic<std::size_t> found(0);
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < 4; ++i) {
+            threads.emplace_back([&args, &found] ()
+            {
+                argparse::Namespace const copy = args;
+                for (std::size_t j = 0; j < 100; ++j) {
+                    if (copy.exists("qux") && !copy.exists("baz")
+                            && copy.get<std::string>("bar") == "2") {
+                        ++found;
+                    }
+                }
+            });
+        }
+        for (std::size_t i = 0; i < threads.size(); ++i) {
+            threads.at(i).join();
+        }
+        CHECK(found == 400);
+    }
+#endif  // C++11+
+}
+
+TEST_CASE("8. namespace items", "[namespace]")
+{
+    argparse::ArgumentParser parser = argparse::ArgumentParser().exit_on_error(false);
+    parser.add_argument("--foo").default_value("1");
+    parser.add_argument("--bar").action("store_true");
+    parser.add_argument("--baz");
+    parser.add_argument("-v").action("count");
+    parser.add_argument("pos").nargs("?");
+
+    SECTION("8.1. items in declaration order") {
+        argparse::Namespace const args = parser.parse_args("--bar -vv --baz 2");
+        std::vector<argparse::ParsedArgument> const items = args.items();
+
+        REQUIRE(items.size() == 5);
+        CHECK(items.at(0).dest() == "foo");
+        CHECK(items.at(0).argument().flags().front() == "--foo");
+        CHECK(items.at(0).values().size() == 1);
+        CHECK(items.at(0).values().front() == "1");
+        CHECK(items.at(0).is_default());
+        CHECK(items.at(0).source() == argparse::ParsedArgument::Default);
+
+        CHECK(items.at(1).dest() == "bar");
+        CHECK(!items.at(1).is_default());
+        CHECK(items.at(1).source() == argparse::ParsedArgument::CommandLine);
+
+        CHECK(items.at(2).dest() == "baz");
+        CHECK(&items.at(2).values() == &args.values_view("baz"));
+        CHECK(items.at(2).source() == argparse::ParsedArgument::CommandLine);
+
+        CHECK(items.at(3).dest() == "v");
+        CHECK(items.at(3).values().size() == 2);
+        CHECK(args.get<int>(items.at(3).key()) == 2);
+        CHECK(items.at(3).source() == argparse::ParsedArgument::CommandLine);
+
+        CHECK(items.at(4).dest() == "pos");
+        CHECK(items.at(4).values().empty());
+        CHECK(items.at(4).source() == argparse::ParsedArgument::NotSet);
+    }
+
+    SECTION("8.2. default values") {
+        argparse::Namespace const args = parser.parse_args("");
+        std::vector<argparse::ParsedArgument> const items = args.items();
+
+        REQUIRE(items.size() == 5);
+        CHECK(items.at(0).source() == argparse::ParsedArgument::Default);
+        CHECK(items.at(1).source() == argparse::ParsedArgument::Default);
+        CHECK(args.get<bool>(items.at(1).key()) == false);
+        CHECK(items.at(2).source() == argparse::ParsedArgument::NotSet);
+        CHECK(items.at(3).source() == argparse::ParsedArgument::NotSet);
+    }
+}
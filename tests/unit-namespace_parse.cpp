@@ -125,3 +125,111 @@ TEST_CASE("1. namespace", "[argument_parser]")
         CHECK(args4.get<std::string>("baz") == baz);
     }
 }
+
+TEST_CASE("2. update namespace", "[argument_parser]")
+{
+    argparse::ArgumentParser parser = argparse::ArgumentParser().exit_on_error(false);
+    parser.add_argument("--foo").default_value("foo");
+    parser.add_argument("--bar").default_value("bar");
+    parser.add_argument("--add").action("append");
+    parser.add_argument("-v").action("count");
+    parser.add_argument("--opt").default_value(argparse::SUPPRESS);
+
+    SECTION("2.1. update arguments") {
+        argparse::Namespace args = parser.parse_args("--foo 1 --add a -v");
+        argparse::Namespace copy = args;
+
+        parser.update_args("--bar 2 --add b -v", args);
+        CHECK(args.get<std::string>("foo") == "1");
+        CHECK(args.get<std::string>("bar") == "2");
+        CHECK(args.to_string("add") == "[a, b]");
+        CHECK(args.get<int>("v") == 2);
+        CHECK(!args.exists("opt"));
+
+        parser.update_args("--foo 3 --opt 4", args);
+        CHECK(args.get<std::string>("foo") == "3");
+        CHECK(args.get<std::string>("bar") == "2");
+        CHECK(args.get<std::string>("opt") == "4");
+
+        CHECK(copy.get<std::string>("foo") == "1");
+        CHECK(copy.get<std::string>("bar") == "bar");
+        CHECK(copy.to_string("add") == "[a]");
+        CHECK(copy.get<int>("v") == 1);
+        CHECK(!copy.exists("opt"));
+    }
+
+    SECTION("2.2. update arguments with frozen parser") {
+        std::string bound;
+        parser.add_argument("--bound").bind(bound);
+        parser.freeze();
+
+        argparse::Namespace args = parser.parse_args("--foo 1 --add a");
+        CHECK(args.get<std::string>("foo") == "1");
+        CHECK(args.get<std::string>("bar") == "bar");
+        CHECK(!args.exists("opt"));
+
+        parser.update_args(_make_vec("--bar", "2", "--add", "b", "-vv"), args);
+        CHECK(args.get<std::string>("foo") == "1");
+        CHECK(args.get<std::string>("bar") == "2");
+        CHECK(args.to_string("add") == "[a, b]");
+        CHECK(args.get<int>("v") == 2);
+        CHECK(!args.exists("opt"));
+
+        parser.update_args("--bound 5", args);
+        CHECK(bound == "5");
+        CHECK(args.get<std::string>("bound") == "5");
+        CHECK(!args.exists("opt"));
+
+        parser.update_args("--opt 6", args);
+        CHECK(args.get<std::string>("opt") == "6");
+        CHECK(args.get<std::string>("bound") == "5");
+        CHECK(args.items().size() == 6);
+    }
+
+    SECTION("2.3. update arguments error") {
+        for (int frozen = 0; frozen < 2; ++frozen) {
+            if (frozen) {
+                parser.freeze();
+            }
+            argparse::Namespace args = parser.parse_args("--foo 1 --add a");
+            std::string const before = args.to_string();
+            CHECK_THROWS(parser.update_args("--bar 2 --unknown", args));
+            CHECK(args.get<std::string>("foo") == "1");
+            CHECK(args.get<std::string>("bar") == "bar");
+            CHECK(args.to_string() == before);
+
+            CHECK_THROWS(parser.update_args("--add b -v --opt 2 --unknown", args));
+            CHECK(args.to_string("add") == "[a]");
+            CHECK(!args.exists("opt"));
+            CHECK(args.to_string() == before);
+
+            parser.update_args("--foo 3", args);
+            CHECK(args.get<std::string>("foo") == "3");
+        }
+    }
+
+    SECTION("2.4. update arguments with required positionals") {
+        parser.add_argument("file");
+        parser.add_argument("names").nargs("*");
+
+        for (int frozen = 0; frozen < 2; ++frozen) {
+            if (frozen) {
+                parser.freeze();
+            }
+            argparse::Namespace args = parser.parse_args("x.txt a b");
+            parser.update_args("--foo 3", args);
+            CHECK(args.get<std::string>("foo") == "3");
+            CHECK(args.get<std::string>("file") == "x.txt");
+            CHECK(args.to_string("names") == "[a, b]");
+
+            parser.update_args("y.txt", args);
+            CHECK(args.get<std::string>("file") == "y.txt");
+            CHECK(args.get<std::string>("foo") == "3");
+
+            argparse::Namespace empty = parser.parse_args("--foo 1 x.txt");
+            parser.update_args("--bar 2", empty);
+            CHECK(empty.get<std::string>("file") == "x.txt");
+            CHECK(empty.to_string("names") == "[]");
+        }
+    }
+}
@@ -84,4 +84,37 @@ TEST_CASE("2. get | try_get", "[namespace]")
         CHECK(!args.try_get<int16_t>("f").has_value());
 #endif  // ARGPARSE_HAS_STRING_VIEW
     }
+
+    SECTION("2.3. integer limits") {
+        parser.add_argument("--max").nargs(2);
+        parser.add_argument("--min");
+        parser.add_argument("--low");
+        parser.add_argument("--neg");
+
+        argparse::Namespace const args = parser.parse_args(
+                    "--max 9223372036854775807 18446744073709551615 "
+                    "--min=-9223372036854775808 --low=-9223372036854775809 --neg=-1");
+
+        CHECK_THROWS(args.get<std::vector<int64_t> >("max"));
+        CHECK(args.get<std::vector<uint64_t> >("max").at(0) == static_cast<uint64_t>(std::numeric_limits<int64_t>::max()));
+        CHECK(args.get<std::vector<uint64_t> >("max").at(1) == std::numeric_limits<uint64_t>::max());
+        CHECK(args.get<int64_t>("min") == std::numeric_limits<int64_t>::min());
+        CHECK_THROWS(args.get<int64_t>("low"));
+        CHECK(args.get<int64_t>("neg") == -1);
+        CHECK(args.get<int16_t>("neg") == -1);
+    }
+
+    SECTION("2.4. floating point value") {
+        parser.add_argument("-f").nargs(4);
+
+        argparse::Namespace const args = parser.parse_args("-f 1.5 -.25 1e3 2.5e-1");
+
+        std::vector<double> values = args.get<std::vector<double> >("f");
+        REQUIRE(values.size() == 4);
+        CHECK(values.at(0) == 1.5);
+        CHECK(values.at(1) == -0.25);
+        CHECK(values.at(2) == 1000.0);
+        CHECK(values.at(3) == 0.25);
+        CHECK_THROWS(args.get<std::vector<int> >("f"));
+    }
 }
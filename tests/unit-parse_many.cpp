@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2026 Golubchikov Mihail <https://github.com/rue-ryuzaki>
+ */
+
+#define ARGPARSE_DECLARATION
+#include "./argparse_test.hpp"
+
+#include <string>
+#include <vector>
+
+TEST_CASE("1. parse many", "[argument_parser]")
+{
+    argparse::ArgumentParser parser = argparse::ArgumentParser().exit_on_error(false);
+    parser.add_argument("--foo").required(true).help("foo help");
+    parser.add_argument("--bar").deprecated(true).help("bar help");
+    parser.add_argument("baz").choices("abc").help("baz help");
+
+    std::vector<std::string> command_lines;
+    for (std::size_t i = 0; i < 100; ++i) {
+        command_lines.push_back("--foo " + argparse::detail::_to_string(i) + " a");
+    }
+    command_lines.at(10) = "--foo 10 d";
+    command_lines.at(20) = "a";
+    command_lines.at(30) = "--foo 30 --bar 1 b";
+
+    SECTION("1.1. command lines") {
+        for (std::size_t jobs = 0; jobs < 4; ++jobs) {
+            std::vector<argparse::ParseResult> res = parser.parse_many(command_lines, jobs);
+            REQUIRE(res.size() == command_lines.size());
+            for (std::size_t i = 0; i < res.size(); ++i) {
+                if (i == 10 || i == 20) {
+                    continue;
+                }
+                REQUIRE(res.at(i).has_value());
+                CHECK(res.at(i).error() == "");
+                CHECK(res.at(i).value().get<std::string>("foo") == argparse::detail::_to_string(i));
+            }
+            CHECK(res.at(0).output() == "");
+
+            CHECK_FALSE(res.at(10).has_value());
+            CHECK(res.at(10).error() == "untitled: error: argument baz: invalid choice: "
+                                        "'d' (choose from 'a', 'b', 'c')");
+            CHECK(res.at(10).output() == "usage: untitled [-h] --foo FOO [--bar BAR] {a,b,c}\n");
+            CHECK_THROWS_WITH(res.at(10).value(), res.at(10).error());
+
+            CHECK_FALSE(res.at(20).has_value());
+            CHECK(res.at(20).error() == "untitled: error: the following arguments are required: --foo");
+
+            CHECK(res.at(30).value().get<std::string>("bar") == "1");
+            CHECK(res.at(30).output() == "untitled: warning: option '--bar' is deprecated\n");
+        }
+    }
+
+    SECTION("1.2. arguments") {
+        std::vector<std::vector<std::string> > args;
+        args.push_back(_make_vec("--foo", "1", "c"));
+        args.push_back(_make_vec("--foo", "2", "c", "d"));
+        std::vector<argparse::ParseResult> res = parser.parse_many(args, 2);
+        REQUIRE(res.size() == 2);
+        CHECK(res.at(0).value().get<std::string>("baz") == "c");
+        CHECK(res.at(1).error() == "untitled: error: unrecognized arguments: d");
+    }
+
+    SECTION("1.3. help and version") {
+        parser.add_argument("--version").action("version").version("1.0");
+        command_lines.at(40) = "-h";
+        command_lines.at(50) = "--foo 50 --version";
+        for (std::size_t jobs = 1; jobs < 4; ++jobs) {
+            std::vector<argparse::ParseResult> res = parser.parse_many(command_lines, jobs);
+            REQUIRE(res.size() == command_lines.size());
+            CHECK(res.at(40).error_code() == argparse::ParseResult::Help);
+            CHECK(res.at(40).output() == parser.format_help() + "\n");
+            CHECK(res.at(50).error_code() == argparse::ParseResult::Version);
+            CHECK(res.at(50).output() == "1.0\n");
+            CHECK(res.at(60).value().get<std::string>("foo") == "60");
+        }
+    }
+}
+
+TEST_CASE("2. parse one", "[argument_parser]")
+{
+    argparse::ArgumentParser parser = argparse::ArgumentParser().exit_on_error(false);
+    parser.add_argument("--foo").required(true);
+    parser.add_argument("--num").type<int>();
+    parser.add_argument("--pair").nargs(2);
+    parser.add_argument("--flag").action("store_true");
+    parser.add_argument("baz").choices("abc");
+    argparse::MutuallyExclusiveGroup& group = parser.add_mutually_exclusive_group();
+    group.add_argument("--left").action("store_true");
+    group.add_argument("--right").action("store_true");
+
+    SECTION("2.1. parsed command line") {
+        argparse::ParseResult res = parser.parse_one("--foo 1 a");
+        REQUIRE(res.has_value());
+        CHECK(res.error_code() == argparse::ParseResult::NoError);
+        CHECK(res.error_index() == std::string::npos);
+        CHECK(res.error() == "");
+        CHECK(res.value().get<std::string>("foo") == "1");
+        CHECK(res.value().get<std::string>("baz") == "a");
+    }
+
+    SECTION("2.2. parse errors") {
+        argparse::ParseResult res = parser.parse_one("--foo 1 d");
+        CHECK_FALSE(res.has_value());
+        CHECK(res.error_code() == argparse::ParseResult::InvalidChoice);
+        CHECK(res.error_index() == 2);
+        CHECK(res.error_argument().name() == "baz");
+        CHECK(res.error() == "untitled: error: argument baz: invalid choice: "
+                             "'d' (choose from 'a', 'b', 'c')");
+        CHECK(res.output() == "usage: untitled [-h] --foo FOO [--num NUM] [--pair PAIR PAIR] [--flag]\n"
+                              "                [--left | --right] {a,b,c}\n");
+        CHECK_THROWS_WITH(parser.parse_args("--foo 1 d"), res.error());
+
+        res = parser.parse_one("--foo 1 --num x a");
+        CHECK(res.error_code() == argparse::ParseResult::InvalidValue);
+        CHECK(res.error_index() == 2);
+        CHECK(res.error_argument().name() == "num");
+        CHECK(res.error() == "untitled: error: argument --num: invalid int value: 'x'");
+
+        res = parser.parse_one("--foo 1 a --pair 1");
+        CHECK(res.error_code() == argparse::ParseResult::ExpectedArguments);
+        CHECK(res.error_index() == 3);
+        CHECK(res.error_argument().name() == "pair");
+        CHECK(res.error() == "untitled: error: argument --pair: expected 2 arguments");
+
+        res = parser.parse_one("--foo 1 a --flag=1");
+        CHECK(res.error_code() == argparse::ParseResult::IgnoredExplicitArgument);
+        CHECK(res.error_index() == 3);
+        CHECK(res.error_argument().name() == "flag");
+
+        res = parser.parse_one("--foo 1 a --left --right");
+        CHECK(res.error_code() == argparse::ParseResult::NotAllowedArguments);
+        CHECK(res.error_index() == std::string::npos);
+        CHECK(res.error_argument().name() == "right");
+        CHECK(res.error() == "untitled: error: argument --right: not allowed with argument --left");
+
+        res = parser.parse_one("a");
+        CHECK(res.error_code() == argparse::ParseResult::RequiredArguments);
+        CHECK(res.error_index() == std::string::npos);
+        CHECK(res.error_argument().name() == "");
+        CHECK(res.error() == "untitled: error: the following arguments are required: --foo");
+
+        res = parser.parse_one("--foo 1 a b c");
+        CHECK(res.error_code() == argparse::ParseResult::UnrecognizedArguments);
+        CHECK(res.error_index() == 3);
+        CHECK(res.error() == "untitled: error: unrecognized arguments: b c");
+
+        res = parser.parse_one("--foo 1 --bar a");
+        CHECK(res.error_code() == argparse::ParseResult::UnrecognizedArguments);
+        CHECK(res.error_index() == 2);
+
+        res = parser.parse_one("--fo 1 --f a");
+        CHECK(res.error_code() == argparse::ParseResult::AmbiguousOption);
+        CHECK(res.error_index() == 2);
+        CHECK(res.error() == "untitled: error: ambiguous option: '--f' could match --foo, --flag");
+    }
+}
+
+TEST_CASE("3. parse one positional values", "[argument_parser]")
+{
+    argparse::ArgumentParser parser = argparse::ArgumentParser().exit_on_error(false);
+    parser.add_argument("--foo");
+    parser.add_argument("a").choices("uv");
+    parser.add_argument("b").choices("uv");
+    parser.add_argument("num").nargs("+").type<int>();
+
+    SECTION("3.1. invalid choice") {
+        argparse::ParseResult res = parser.parse_one("u w 1");
+        CHECK(res.error_code() == argparse::ParseResult::InvalidChoice);
+        CHECK(res.error_index() == 1);
+        CHECK(res.error_argument().name() == "b");
+
+        res = parser.parse_one("--foo 1 x w 1");
+        CHECK(res.error_code() == argparse::ParseResult::InvalidChoice);
+        CHECK(res.error_index() == 2);
+        CHECK(res.error_argument().name() == "a");
+    }
+
+    SECTION("3.2. invalid value") {
+        argparse::ParseResult res = parser.parse_one("u v 1 2 x");
+        CHECK(res.error_code() == argparse::ParseResult::InvalidValue);
+        CHECK(res.error_index() == 4);
+        CHECK(res.error_argument().name() == "num");
+
+        res = parser.parse_one("u --foo 1 v y");
+        CHECK(res.error_code() == argparse::ParseResult::InvalidValue);
+        CHECK(res.error_index() == 4);
+    }
+
+    SECTION("3.3. subparser choice") {
+        argparse::ArgumentParser cmd = argparse::ArgumentParser().exit_on_error(false);
+        cmd.add_argument("--foo");
+        argparse::SubParsers& subparsers = cmd.add_subparsers().dest("cmd");
+        subparsers.add_parser("build").add_argument("target").choices("ab");
+
+        argparse::ParseResult res = cmd.parse_one("--foo 1 run");
+        CHECK(res.error_code() == argparse::ParseResult::InvalidChoice);
+        CHECK(res.error_index() == 2);
+
+        res = cmd.parse_one("build c");
+        CHECK(res.error_code() == argparse::ParseResult::InvalidChoice);
+        CHECK(res.error_index() == 1);
+        CHECK(res.error_argument().name() == "target");
+    }
+}
+
+TEST_CASE("4. parse one help and version", "[argument_parser]")
+{
+    argparse::ArgumentParser parser = argparse::ArgumentParser("prog").exit_on_error(false);
+    parser.add_argument("--version").action("version").version("%(prog)s 1.0");
+    parser.add_argument("foo");
+
+    SECTION("4.1. help") {
+        argparse::ParseResult res = parser.parse_one("-h");
+        CHECK_FALSE(res.has_value());
+        CHECK(res.error_code() == argparse::ParseResult::Help);
+        CHECK(res.error() == "");
+        CHECK(res.output() == parser.format_help() + "\n");
+    }
+
+    SECTION("4.2. version") {
+        argparse::ParseResult res = parser.parse_one("--version");
+        CHECK_FALSE(res.has_value());
+        CHECK(res.error_code() == argparse::ParseResult::Version);
+        CHECK(res.output() == "prog 1.0\n");
+
+        res = parser.parse_one("--version=1");
+        CHECK(res.error_code() == argparse::ParseResult::IgnoredExplicitArgument);
+    }
+
+    SECTION("4.3. subparser help") {
+        argparse::SubParsers& subparsers = parser.add_subparsers().dest("cmd");
+        argparse::ArgumentParser& build = subparsers.add_parser("build").exit_on_error(false);
+        build.add_argument("target");
+
+        argparse::ParseResult res = parser.parse_one("x build -h");
+        CHECK(res.error_code() == argparse::ParseResult::Help);
+        CHECK(res.output() == build.format_help() + "\n");
+    }
+}
@@ -5,6 +5,37 @@
 #define ARGPARSE_DECLARATION
 #include "./argparse_test.hpp"
 
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <utime.h>
+#endif  // _WIN32
+
+static void
+_write_file(std::string const& name, std::string const& content)
+{
+    std::ofstream os(name.c_str());
+    os << content;
+}
+
+#ifndef _WIN32
+static void
+_write_old_file(std::string const& name, std::string const& content)
+{
+    _write_file(name, content);
+    // not recently modified files are cached
+    struct utimbuf times;
+    times.actime = 1000000000;
+    times.modtime = 1000000000;
+    utime(name.c_str(), &times);
+}
+#endif  // _WIN32
+
 TEST_CASE("1. prefix chars '='", "[argument_parser]")
 {
     argparse::ArgumentParser parser = argparse::ArgumentParser().prefix_chars("=").exit_on_error(false);
@@ -39,3 +70,146 @@ TEST_CASE("1. prefix chars '='", "[argument_parser]")
         CHECK(args1.get<std::string>("bar") == "bar");
     }
 }
+
+TEST_CASE("2. fromfile prefix chars", "[argument_parser]")
+{
+    argparse::ArgumentParser parser = argparse::ArgumentParser()
+            .fromfile_prefix_chars("@").comment_prefix_chars("#").exit_on_error(false);
+
+    parser.add_argument("-f", "--foo").action("append");
+    parser.add_argument("bar").nargs("*");
+
+    _write_file("unit-fromfile-inner.args", "--foo\ninner\n#comment\n");
+    _write_file("unit-fromfile-empty.args", "");
+    _write_file("unit-fromfile-outer.args", "-f\nouter\n@unit-fromfile-inner.args\nbar1");
+
+    SECTION("2.1. nested files") {
+        argparse::Namespace args = parser.parse_args(
+                    _make_vec("@unit-fromfile-outer.args", "bar2", "#skip"));
+        CHECK(args.to_string("foo") == "[outer, inner]");
+        CHECK(args.to_string("bar") == "[bar1, bar2]");
+    }
+
+    SECTION("2.2. empty file") {
+        argparse::Namespace args = parser.parse_args(
+                    _make_vec("bar1", "@unit-fromfile-empty.args"));
+        CHECK(args.to_string("bar") == "[bar1]");
+    }
+
+    SECTION("2.3. missing file") {
+        REQUIRE_THROWS_WITH(parser.parse_args(_make_vec("@unit-fromfile-missing.args")),
+                            "untitled: error: [Errno 2] No such file or directory: "
+                            "'unit-fromfile-missing.args'");
+    }
+
+    SECTION("2.4. recursive files") {
+        _write_file("unit-fromfile-self.args", "a\n@unit-fromfile-self.args\n");
+        REQUIRE_THROWS_WITH(parser.parse_args(_make_vec("@unit-fromfile-self.args")),
+                            "untitled: error: recursive fromfile arguments file: "
+                            "'unit-fromfile-self.args'");
+        std::remove("unit-fromfile-self.args");
+    }
+
+    SECTION("2.5. shared files") {
+        argparse::Namespace args = parser.parse_args(
+                    _make_vec("@unit-fromfile-inner.args", "@unit-fromfile-outer.args"));
+        CHECK(args.to_string("foo") == "[inner, outer, inner]");
+        CHECK(args.to_string("bar") == "[bar1]");
+
+        _write_file("unit-fromfile-inner.args", "--foo\nchanged\n");
+        args = parser.parse_args(_make_vec("@unit-fromfile-outer.args"));
+        CHECK(args.to_string("foo") == "[outer, changed]");
+    }
+
+    SECTION("2.6. max depth") {
+        parser.fromfile_max_depth(1);
+        CHECK(parser.fromfile_max_depth() == 1);
+        CHECK_NOTHROW(parser.parse_args(_make_vec("@unit-fromfile-inner.args")));
+        REQUIRE_THROWS_WITH(parser.parse_args(_make_vec("@unit-fromfile-outer.args")),
+                            "untitled: error: fromfile arguments files nested too deeply: "
+                            "'unit-fromfile-inner.args'");
+    }
+
+    SECTION("2.7. max args") {
+        parser.fromfile_max_args(4);
+        CHECK(parser.fromfile_max_args() == 4);
+        CHECK_NOTHROW(parser.parse_args(_make_vec("@unit-fromfile-inner.args", "b1", "b2")));
+        REQUIRE_THROWS_WITH(parser.parse_args(_make_vec("@unit-fromfile-outer.args")),
+                            "untitled: error: too many arguments in fromfile arguments file: "
+                            "'unit-fromfile-outer.args'");
+    }
+
+    SECTION("2.8. changed file with the same size") {
+        _write_file("unit-fromfile-inner.args", "--foo\nfirst\n");
+        argparse::Namespace args = parser.parse_args(_make_vec("@unit-fromfile-inner.args"));
+        CHECK(args.to_string("foo") == "[first]");
+
+        _write_file("unit-fromfile-inner.args", "--foo\nfixed\n");
+        args = parser.parse_args(_make_vec("@unit-fromfile-inner.args"));
+        CHECK(args.to_string("foo") == "[fixed]");
+    }
+
+    SECTION("2.9. max args of the file") {
+        _write_file("unit-fromfile-inner.args", "a\nb\nc\nd\ne\nf\n");
+        parser.fromfile_max_args(4);
+        REQUIRE_THROWS_WITH(parser.parse_args(_make_vec("@unit-fromfile-inner.args")),
+                            "untitled: error: too many arguments in fromfile arguments file: "
+                            "'unit-fromfile-inner.args'");
+    }
+
+#ifndef _WIN32
+    SECTION("2.10. fifo file") {
+        std::string const name = "unit-fromfile-fifo.args";
+        std::remove(name.c_str());
+        REQUIRE(mkfifo(name.c_str(), 0600) == 0);
+        for (int i = 0; i < 2; ++i) {
+            pid_t pid = fork();
+            REQUIRE(pid >= 0);
+            if (pid == 0) {
+                std::string const content = i == 0 ? "--foo\nfirst\n" : "--foo\nsecond\n";
+                FILE* file = std::fopen(name.c_str(), "w");
+                if (file) {
+                    std::fputs(content.c_str(), file);
+                    std::fclose(file);
+                }
+                _exit(0);
+            }
+            argparse::Namespace args = parser.parse_args(_make_vec("@" + name));
+            waitpid(pid, NULL, 0);
+            CHECK(args.to_string("foo") == (i == 0 ? "[first]" : "[second]"));
+        }
+        std::remove(name.c_str());
+    }
+
+    SECTION("2.11. cache size") {
+        CHECK(parser.fromfile_cache_size() == 64);
+        parser.fromfile_cache_size(2);
+        CHECK(parser.fromfile_cache_size() == 2);
+
+        _write_old_file("unit-fromfile-a.args", "--foo\na1\n");
+        _write_old_file("unit-fromfile-b.args", "--foo\nb1\n");
+        _write_old_file("unit-fromfile-c.args", "--foo\nc1\n");
+        parser.parse_args(_make_vec("@unit-fromfile-a.args"));
+        parser.parse_args(_make_vec("@unit-fromfile-b.args"));
+        parser.parse_args(_make_vec("@unit-fromfile-a.args"));
+        // the least recently used file is dropped
+        parser.parse_args(_make_vec("@unit-fromfile-c.args"));
+
+        _write_old_file("unit-fromfile-a.args", "--foo\na2\n");
+        _write_old_file("unit-fromfile-b.args", "--foo\nb2\n");
+        CHECK(parser.parse_args(_make_vec("@unit-fromfile-a.args")).to_string("foo") == "[a1]");
+        CHECK(parser.parse_args(_make_vec("@unit-fromfile-b.args")).to_string("foo") == "[b2]");
+
+        parser.fromfile_cache_size(0);
+        CHECK(parser.parse_args(_make_vec("@unit-fromfile-a.args")).to_string("foo") == "[a2]");
+
+        std::remove("unit-fromfile-a.args");
+        std::remove("unit-fromfile-b.args");
+        std::remove("unit-fromfile-c.args");
+    }
+#endif  // _WIN32
+
+    std::remove("unit-fromfile-inner.args");
+    std::remove("unit-fromfile-empty.args");
+    std::remove("unit-fromfile-outer.args");
+}
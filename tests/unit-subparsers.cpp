@@ -25,6 +25,27 @@ parser_b_handle_check(argparse::Namespace const& args)
 }
 #endif  // C++11-
 
+std::size_t nested_handle_calls = 0;
+
+void
+parser_a_nested_handle_check(argparse::Namespace const& args)
+{
+    ++nested_handle_calls;
+    CHECK(args.exists("foo") == false);
+    CHECK(args.exists("cmd") == true);
+    CHECK(args.exists("sub") == true);
+    CHECK(args.get<std::string>("qux") == "1");
+}
+
+void
+parser_x_nested_handle_check(argparse::Namespace const& args)
+{
+    ++nested_handle_calls;
+    CHECK(args.exists("cmd") == false);
+    CHECK(args.get<std::string>("sub") == "x");
+    CHECK(args.get<std::string>("qux") == "1");
+}
+
 TEST_CASE("1. subparsers", "[argument_parser]")
 {
     argparse::ArgumentParser parser = argparse::ArgumentParser().exit_on_error(false);
@@ -343,4 +364,23 @@ TEST_CASE("1. subparsers", "[argument_parser]")
         parser.parse_args(_make_vec("a", "12"));
         parser.parse_args(_make_vec("--foo", "b", "--baz", "Z"));
     }
+
+    SECTION("1.8. nested subparsers namespace handle") {
+        parser.add_argument("--foo").action("store_true").help("foo help");
+
+        argparse::ArgumentParser& parser_a = parser.add_subparsers().dest("cmd").add_parser("a");
+        parser_a.handle(&parser_a_nested_handle_check);
+
+        argparse::ArgumentParser& parser_x = parser_a.add_subparsers().dest("sub").add_parser("x");
+        parser_x.handle(&parser_x_nested_handle_check);
+        parser_x.add_argument("--qux");
+
+        nested_handle_calls = 0;
+        argparse::Namespace const args = parser.parse_args(_make_vec("--foo", "a", "x", "--qux", "1"));
+        CHECK(nested_handle_calls == 2);
+        CHECK(args.get<bool>("foo") == true);
+        CHECK(args.get<std::string>("cmd") == "a");
+        CHECK(args.get<std::string>("sub") == "x");
+        CHECK(args.get<std::string>("qux") == "1");
+    }
 }
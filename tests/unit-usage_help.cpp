@@ -165,4 +165,23 @@ TEST_CASE("3. help", "[argument_parser]")
                  "\n"
                  "epilog");
     }
+
+    SECTION("3.3. help format specifiers") {
+        parser.add_argument("--option").choices("ab").default_value("a")
+                .help("%(dest)s: %(choices)s, default %(default)s %(Foo)s %(");
+
+        CHECK(parser.format_help()
+              == "usage: untitled [-h] [--action | --no-action] [-c COUNT] [--option {a,b}]\n"
+                 "\n"
+                 "description\n"
+                 "\n"
+                 "options:\n"
+                 "  -h, --help            show this help message and exit\n"
+                 "  --action, --no-action\n"
+                 "                        action help\n"
+                 "  -c, --count COUNT     count help\n"
+                 "  --option {a,b}        option: a, b, default a %(Foo)s %(\n"
+                 "\n"
+                 "epilog");
+    }
 }
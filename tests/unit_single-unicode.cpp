@@ -5,6 +5,9 @@
 #include "./argparse_test.hpp"
 
 #include <map>
+#include <sstream>
+#include <string>
+#include <utility>
 
 TEST_CASE("1. unicode to upper", "[detail]")
 {
@@ -1525,3 +1528,37 @@ TEST_CASE("1. unicode to upper", "[detail]")
         }
     }
 }
+
+TEST_CASE("2. utf8 length", "[detail]")
+{
+    std::stringstream err;
+
+    SECTION("2.1. ascii strings") {
+        for (std::size_t i = 0; i < 40; ++i) {
+            std::pair<bool, std::size_t> res = argparse::detail::_utf8_length(std::string(i, 'a'), err);
+            CHECK(res.first);
+            CHECK(res.second == i);
+        }
+        CHECK(err.str().empty());
+    }
+
+    SECTION("2.2. multi-byte code points") {
+        for (std::size_t i = 0; i < 20; ++i) {
+            std::string str = std::string(i, 'a') + "\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80" + std::string(i, 'b');
+            std::pair<bool, std::size_t> res = argparse::detail::_utf8_length(str, err);
+            CHECK(res.first);
+            CHECK(res.second == 2 * i + 3);
+        }
+        CHECK(err.str().empty());
+    }
+
+    SECTION("2.3. invalid strings") {
+        std::string const invalid = std::string(17, 'a') + "\x80";
+        CHECK(argparse::detail::_utf8_length(invalid, err) == std::make_pair(false, invalid.size()));
+        std::string const bounds = std::string(9, 'a') + "\xe2\x82";
+        CHECK(argparse::detail::_utf8_length(bounds, err) == std::make_pair(false, bounds.size()));
+        std::string const nul = std::string("abcdefgh\xc3") + '\0';
+        CHECK(argparse::detail::_utf8_length(nul, err) == std::make_pair(false, nul.size()));
+        CHECK(!err.str().empty());
+    }
+}